@@ -0,0 +1,118 @@
+/**
+ * Arena - bump allocator for data that is freed all at once
+ * See Arena.h for an overview.
+ */
+
+#include "Arena.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+constexpr size_t MAX_SPARE_CHUNKS = 64;     // Beyond this, released chunks return to the heap
+
+static std::mutex s_poolMutex;
+static std::vector<char*> s_spareChunks;    // Guarded by s_poolMutex
+
+static char* AllocateBlock(size_t bytes) {
+    return static_cast<char*>(::operator new(bytes, std::align_val_t(ARENA_MAX_ALIGNMENT)));
+}
+
+static void FreeBlock(char* data) {
+    ::operator delete(data, std::align_val_t(ARENA_MAX_ALIGNMENT));
+}
+
+static char* TakeChunk() {
+    {
+        std::lock_guard<std::mutex> lock(s_poolMutex);
+        if (!s_spareChunks.empty()) {
+            char* chunk = s_spareChunks.back();
+            s_spareChunks.pop_back();
+            return chunk;
+        }
+    }
+    return AllocateBlock(ARENA_CHUNK_BYTES);
+}
+
+/**
+ * Hand an arena's blocks back: chunks to the pool, oversized blocks to the heap
+ */
+static void ReleaseBlocks(std::vector<Arena::Block>& blocks) {
+    std::lock_guard<std::mutex> lock(s_poolMutex);
+    for (const Arena::Block& block : blocks) {
+        if (block.size == ARENA_CHUNK_BYTES && s_spareChunks.size() < MAX_SPARE_CHUNKS) {
+            s_spareChunks.push_back(block.data);
+        } else {
+            FreeBlock(block.data);
+        }
+    }
+    blocks.clear();
+}
+
+Arena::~Arena() {
+    // Arenas reset before shutdown hold nothing, so they never touch a destroyed pool
+    if (!blocks.empty()) {
+        ReleaseBlocks(blocks);
+    }
+}
+
+void* ArenaAllocate(Arena& arena, size_t bytes, size_t alignment) {
+    if (!arena.blocks.empty()) {
+        // Blocks are ARENA_MAX_ALIGNMENT aligned, so aligning the offset aligns the address
+        size_t aligned = (arena.offset + alignment - 1) & ~(alignment - 1);
+        if (aligned + bytes <= arena.blocks.back().size) {
+            arena.usedBytes += aligned - arena.offset + bytes;
+            arena.offset = aligned + bytes;
+            arena.peakBytes = std::max(arena.peakBytes, arena.usedBytes);
+            return arena.blocks.back().data + aligned;
+        }
+    }
+
+    Arena::Block block;
+    if (bytes > ARENA_CHUNK_BYTES) {
+        block = {AllocateBlock(bytes), bytes};
+    } else {
+        block = {TakeChunk(), ARENA_CHUNK_BYTES};
+    }
+    arena.blocks.push_back(block);
+    arena.offset = bytes;
+    arena.usedBytes += bytes;
+    arena.peakBytes = std::max(arena.peakBytes, arena.usedBytes);
+    return block.data;
+}
+
+void ResetArena(Arena& arena) {
+    ReleaseBlocks(arena.blocks);
+    arena.offset = 0;
+    arena.usedBytes = 0;
+}
+
+ArenaStats GetArenaStats(const Arena& arena) {
+    ArenaStats stats;
+    stats.usedBytes = arena.usedBytes;
+    stats.peakBytes = arena.peakBytes;
+    for (const Arena::Block& block : arena.blocks) {
+        stats.reservedBytes += block.size;
+    }
+    stats.chunks = static_cast<int>(arena.blocks.size());
+    return stats;
+}
+
+size_t GetArenaPoolBytes() {
+    std::lock_guard<std::mutex> lock(s_poolMutex);
+    return s_spareChunks.size() * ARENA_CHUNK_BYTES;
+}
+
+void ReleaseArenaPool() {
+    std::lock_guard<std::mutex> lock(s_poolMutex);
+    for (char* chunk : s_spareChunks) {
+        FreeBlock(chunk);
+    }
+    s_spareChunks.clear();
+}
+
+const char* ArenaCopyString(Arena& arena, const std::string& text) {
+    char* out = static_cast<char*>(ArenaAllocate(arena, text.size() + 1, 1));
+    std::memcpy(out, text.c_str(), text.size() + 1);
+    return out;
+}
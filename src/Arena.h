@@ -0,0 +1,128 @@
+/**
+ * Arena - bump allocator for data that is freed all at once
+ *
+ * Memory is handed out from fixed-size chunks and released in one step, by
+ * ResetArena() or when the arena is destroyed, instead of piece by piece. Two
+ * lifetimes use it: data derived from the user aircraft (reset when the next
+ * aircraft loads) and each shot table (freed with the table, once the last
+ * reference to it is dropped).
+ *
+ * Released chunks go back to a pool shared by all arenas (any thread, behind
+ * a mutex) rather than to the heap, so a day of aircraft swaps and shot table
+ * rebuilds recycles the same blocks instead of leaving holes in the heap. A
+ * request larger than a chunk gets a block of its own, which is returned to
+ * the heap on release.
+ *
+ * Nothing is destroyed on release: place only trivially destructible types
+ * with ArenaNew, or containers whose elements are destroyed before the arena
+ * (ArenaAllocator). An arena is not thread-safe: one thread fills it and then
+ * publishes it; readers only look once it is published.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+constexpr size_t ARENA_CHUNK_BYTES = 16 * 1024;   // Pooled chunk size
+constexpr size_t ARENA_MAX_ALIGNMENT = 64;        // Largest supported alignment
+
+/**
+ * Footprint of an arena
+ */
+struct ArenaStats {
+    size_t usedBytes = 0;       // Handed out since the last reset (including alignment padding)
+    size_t reservedBytes = 0;   // Held in chunks and oversized blocks
+    size_t peakBytes = 0;       // Largest usedBytes seen
+    int chunks = 0;             // Blocks held
+};
+
+struct Arena {
+    struct Block {
+        char* data;
+        size_t size;
+    };
+    std::vector<Block> blocks;      // In use; the last one is being filled
+    size_t offset = 0;              // Fill level of the last block
+    size_t usedBytes = 0;
+    size_t peakBytes = 0;
+
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    ~Arena();
+};
+
+/**
+ * Allocate uninitialised memory
+ * @param alignment - Power of two, at most ARENA_MAX_ALIGNMENT
+ */
+void* ArenaAllocate(Arena& arena, size_t bytes, size_t alignment);
+
+/**
+ * Release everything allocated since the last reset (chunks go back to the pool)
+ */
+void ResetArena(Arena& arena);
+
+ArenaStats GetArenaStats(const Arena& arena);
+
+/**
+ * Bytes of spare chunks held by the shared pool
+ */
+size_t GetArenaPoolBytes();
+
+/**
+ * Return the pool's spare chunks to the heap (e.g. when the plugin stops)
+ */
+void ReleaseArenaPool();
+
+/**
+ * Allocate and value-initialise count objects
+ */
+template <typename T>
+T* ArenaNew(Arena& arena, size_t count = 1) {
+    static_assert(std::is_trivially_destructible<T>::value, "arena objects are never destroyed");
+    T* out = static_cast<T*>(ArenaAllocate(arena, sizeof(T) * count, alignof(T)));
+    for (size_t i = 0; i < count; i++) {
+        new (&out[i]) T();
+    }
+    return out;
+}
+
+/**
+ * Copy a string into the arena (null-terminated)
+ */
+const char* ArenaCopyString(Arena& arena, const std::string& text);
+
+/**
+ * Standard allocator over an arena, for containers filled once and then kept
+ * Deallocation is a no-op: storage a container grows out of stays in the
+ * arena until it is released.
+ */
+template <typename T>
+struct ArenaAllocator {
+    using value_type = T;
+    Arena* arena;
+
+    explicit ArenaAllocator(Arena* owner) : arena(owner) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(ArenaAllocate(*arena, sizeof(T) * count, alignof(T)));
+    }
+    void deallocate(T*, size_t) {}
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena == b.arena;
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) {
+    return a.arena != b.arena;
+}
@@ -0,0 +1,517 @@
+/**
+ * BeatTracker - offline beat detection for music-synchronised cuts
+ * See BeatTracker.h for an overview.
+ */
+
+#include "BeatTracker.h"
+#include "FileStamp.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <memory>
+
+// Analysis constants
+constexpr int FFT_SIZE = 1024;                      // Analysis window (samples)
+constexpr int FFT_HOP = 512;                        // Hop between windows (samples)
+constexpr int FFT_BINS = FFT_SIZE / 2;
+constexpr int MAX_ONSET_FRAMES = 1 << 17;           // ~25 minutes at 44.1 kHz; longer tracks are truncated
+constexpr int READ_BLOCK_FRAMES = 4096;             // Frames decoded per file read
+constexpr int MAX_CHANNELS = 8;
+constexpr float MIN_BPM = 60.0f;
+constexpr float MAX_BPM = 180.0f;
+constexpr float PREFERRED_BPM = 120.0f;             // Centre of the tempo prior
+constexpr float TEMPO_PRIOR_WIDTH = 1.0f;           // Octaves (standard deviation) of the tempo prior
+constexpr float LOG_COMPRESSION = 100.0f;           // Magnitude compression before spectral flux
+constexpr int ONSET_MEAN_RADIUS = 8;                // Frames either side for the adaptive onset threshold
+constexpr int BEAT_CACHE_VERSION = 2;                // 2: stamped with the audio file mtime
+
+static const float kPi = 3.14159265359f;
+
+/**
+ * Minimal streaming WAV reader (PCM 16/24/32-bit and 32-bit float)
+ * Decodes into mono float samples one block at a time.
+ */
+struct WavReader {
+    FILE* file = nullptr;
+    int channels = 0;
+    int sampleRate = 0;
+    int bitsPerSample = 0;
+    bool isFloat = false;
+    uint32_t dataRemaining = 0;
+    std::vector<unsigned char> raw;     // Fixed-size decode buffer
+
+    ~WavReader() {
+        if (file) fclose(file);
+    }
+};
+
+static uint32_t ReadLE32(const unsigned char* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static uint16_t ReadLE16(const unsigned char* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+/**
+ * Open a WAV file and position it at the start of the sample data
+ */
+static bool OpenWav(const std::string& path, WavReader& wav, std::string& outMessage) {
+    wav.file = fopen(path.c_str(), "rb");
+    if (!wav.file) {
+        outMessage = "cannot open file";
+        return false;
+    }
+
+    unsigned char header[12];
+    if (fread(header, 1, 12, wav.file) != 12 || std::memcmp(header, "RIFF", 4) != 0 ||
+        std::memcmp(header + 8, "WAVE", 4) != 0) {
+        outMessage = "not a WAV file (only WAV is supported)";
+        return false;
+    }
+
+    bool haveFormat = false;
+    unsigned char chunk[8];
+    while (fread(chunk, 1, 8, wav.file) == 8) {
+        uint32_t size = ReadLE32(chunk + 4);
+        if (std::memcmp(chunk, "fmt ", 4) == 0) {
+            unsigned char fmt[40] = {0};
+            uint32_t toRead = std::min<uint32_t>(size, sizeof(fmt));
+            if (fread(fmt, 1, toRead, wav.file) != toRead) break;
+            if (size > toRead) fseek(wav.file, static_cast<long>(size - toRead), SEEK_CUR);
+
+            uint16_t format = ReadLE16(fmt);
+            if (format == 0xFFFE && toRead >= 26) {
+                format = ReadLE16(fmt + 24);  // WAVE_FORMAT_EXTENSIBLE sub-format
+            }
+            wav.channels = ReadLE16(fmt + 2);
+            wav.sampleRate = static_cast<int>(ReadLE32(fmt + 4));
+            wav.bitsPerSample = ReadLE16(fmt + 14);
+            wav.isFloat = (format == 3);
+            haveFormat = (format == 1 || format == 3);
+        } else if (std::memcmp(chunk, "data", 4) == 0) {
+            wav.dataRemaining = size;
+            break;
+        } else {
+            fseek(wav.file, static_cast<long>(size + (size & 1)), SEEK_CUR);
+        }
+    }
+
+    if (!haveFormat || wav.dataRemaining == 0) {
+        outMessage = "unsupported WAV encoding";
+        return false;
+    }
+    bool validBits = wav.isFloat ? wav.bitsPerSample == 32
+                                 : (wav.bitsPerSample == 16 || wav.bitsPerSample == 24 || wav.bitsPerSample == 32);
+    if (!validBits || wav.channels < 1 || wav.channels > MAX_CHANNELS || wav.sampleRate < 8000) {
+        outMessage = "unsupported WAV encoding";
+        return false;
+    }
+
+    wav.raw.resize(static_cast<size_t>(READ_BLOCK_FRAMES) * wav.channels * (wav.bitsPerSample / 8));
+    return true;
+}
+
+/**
+ * Decode up to READ_BLOCK_FRAMES frames, downmixed to mono
+ * @return Number of frames written to out
+ */
+static int ReadMonoBlock(WavReader& wav, float* out) {
+    int bytesPerSample = wav.bitsPerSample / 8;
+    int frameBytes = bytesPerSample * wav.channels;
+    uint32_t wanted = std::min<uint32_t>(wav.dataRemaining, static_cast<uint32_t>(READ_BLOCK_FRAMES * frameBytes));
+    wanted -= wanted % frameBytes;
+    if (wanted == 0) return 0;
+
+    size_t got = fread(wav.raw.data(), 1, wanted, wav.file);
+    wav.dataRemaining -= static_cast<uint32_t>(got);
+    if (got < wanted) wav.dataRemaining = 0;
+    int frames = static_cast<int>(got / frameBytes);
+
+    float channelScale = 1.0f / wav.channels;
+    const unsigned char* p = wav.raw.data();
+    for (int i = 0; i < frames; i++) {
+        float sum = 0.0f;
+        for (int c = 0; c < wav.channels; c++, p += bytesPerSample) {
+            if (wav.isFloat) {
+                float v;
+                std::memcpy(&v, p, 4);
+                sum += v;
+            } else if (bytesPerSample == 2) {
+                sum += static_cast<int16_t>(ReadLE16(p)) / 32768.0f;
+            } else if (bytesPerSample == 3) {
+                int32_t v = static_cast<int32_t>((static_cast<uint32_t>(p[0]) << 8) | (static_cast<uint32_t>(p[1]) << 16) |
+                                                 (static_cast<uint32_t>(p[2]) << 24)) >> 8;
+                sum += v / 8388608.0f;
+            } else {
+                sum += static_cast<int32_t>(ReadLE32(p)) / 2147483648.0f;
+            }
+        }
+        out[i] = sum * channelScale;
+    }
+    return frames;
+}
+
+/**
+ * Fixed-size working state of the onset detector
+ * Allocated once per analysis; nothing grows while streaming.
+ */
+struct OnsetDetector {
+    float window[FFT_SIZE];            // Hann window
+    float cosTable[FFT_SIZE / 2];      // FFT twiddles
+    float sinTable[FFT_SIZE / 2];
+    int bitReverse[FFT_SIZE];
+    float frame[FFT_SIZE];             // Sliding analysis frame
+    float re[FFT_SIZE];
+    float im[FFT_SIZE];
+    float previous[FFT_BINS];          // Compressed magnitudes of the previous frame
+    int filled = 0;                    // Samples currently in frame
+    bool primed = false;               // previous holds a real frame
+
+    OnsetDetector() {
+        int bits = 0;
+        while ((1 << bits) < FFT_SIZE) bits++;
+        for (int i = 0; i < FFT_SIZE; i++) {
+            window[i] = 0.5f - 0.5f * std::cos(2.0f * kPi * i / FFT_SIZE);
+            int r = 0;
+            for (int b = 0; b < bits; b++) {
+                if (i & (1 << b)) r |= 1 << (bits - 1 - b);
+            }
+            bitReverse[i] = r;
+        }
+        for (int i = 0; i < FFT_SIZE / 2; i++) {
+            cosTable[i] = std::cos(2.0f * kPi * i / FFT_SIZE);
+            sinTable[i] = -std::sin(2.0f * kPi * i / FFT_SIZE);
+        }
+        std::memset(previous, 0, sizeof(previous));
+    }
+
+    /**
+     * In-place iterative radix-2 FFT of re/im
+     * The inner butterfly loop is contiguous and branch-free so the compiler can vectorise it
+     */
+    void Transform() {
+        for (int i = 0; i < FFT_SIZE; i++) {
+            int j = bitReverse[i];
+            if (j > i) {
+                std::swap(re[i], re[j]);
+                std::swap(im[i], im[j]);
+            }
+        }
+        for (int size = 2; size <= FFT_SIZE; size <<= 1) {
+            int half = size >> 1;
+            int step = FFT_SIZE / size;
+            for (int start = 0; start < FFT_SIZE; start += size) {
+                float* reA = re + start;
+                float* imA = im + start;
+                float* reB = re + start + half;
+                float* imB = im + start + half;
+                for (int k = 0; k < half; k++) {
+                    float wr = cosTable[k * step];
+                    float wi = sinTable[k * step];
+                    float tr = reB[k] * wr - imB[k] * wi;
+                    float ti = reB[k] * wi + imB[k] * wr;
+                    reB[k] = reA[k] - tr;
+                    imB[k] = imA[k] - ti;
+                    reA[k] += tr;
+                    imA[k] += ti;
+                }
+            }
+        }
+    }
+
+    /**
+     * Spectral flux of the current frame against the previous one
+     */
+    float ProcessFrame() {
+        for (int i = 0; i < FFT_SIZE; i++) {
+            re[i] = frame[i] * window[i];
+            im[i] = 0.0f;
+        }
+        Transform();
+
+        float flux = 0.0f;
+        for (int i = 0; i < FFT_BINS; i++) {
+            float magnitude = std::log1p(LOG_COMPRESSION * std::sqrt(re[i] * re[i] + im[i] * im[i]));
+            flux += std::max(0.0f, magnitude - previous[i]);
+            previous[i] = magnitude;
+        }
+
+        // The first frame has nothing to compare against
+        if (!primed) {
+            primed = true;
+            return 0.0f;
+        }
+        return flux;
+    }
+};
+
+/**
+ * Stream the audio through the onset detector
+ */
+static bool ComputeOnsetEnvelope(WavReader& wav, const std::atomic<bool>& cancel,
+                                 std::vector<float>& outEnvelope, std::string& outMessage) {
+    std::unique_ptr<OnsetDetector> detector(new OnsetDetector());
+    std::vector<float> block(READ_BLOCK_FRAMES);
+    outEnvelope.clear();
+    outEnvelope.reserve(MAX_ONSET_FRAMES);
+
+    int frames;
+    while ((frames = ReadMonoBlock(wav, block.data())) > 0) {
+        if (cancel.load()) {
+            outMessage = "cancelled";
+            return false;
+        }
+        int consumed = 0;
+        while (consumed < frames) {
+            int take = std::min(frames - consumed, FFT_SIZE - detector->filled);
+            std::memcpy(detector->frame + detector->filled, block.data() + consumed, take * sizeof(float));
+            detector->filled += take;
+            consumed += take;
+            if (detector->filled == FFT_SIZE) {
+                if (static_cast<int>(outEnvelope.size()) >= MAX_ONSET_FRAMES) {
+                    outMessage = "track truncated";
+                    return true;
+                }
+                outEnvelope.push_back(detector->ProcessFrame());
+                std::memmove(detector->frame, detector->frame + FFT_HOP, (FFT_SIZE - FFT_HOP) * sizeof(float));
+                detector->filled = FFT_SIZE - FFT_HOP;
+            }
+        }
+    }
+
+    if (outEnvelope.size() < 64) {
+        outMessage = "track too short";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Estimate tempo and beat positions from the onset envelope
+ */
+static void TrackBeats(std::vector<float>& envelope, int sampleRate, BeatTimeline& outTimeline) {
+    int count = static_cast<int>(envelope.size());
+    float framesPerSecond = static_cast<float>(sampleRate) / FFT_HOP;
+
+    // Adaptive threshold: keep only what rises above the local mean
+    std::vector<float> prefix(count + 1, 0.0f);
+    for (int i = 0; i < count; i++) prefix[i + 1] = prefix[i] + envelope[i];
+    for (int i = 0; i < count; i++) {
+        int lo = std::max(0, i - ONSET_MEAN_RADIUS);
+        int hi = std::min(count, i + ONSET_MEAN_RADIUS + 1);
+        float mean = (prefix[hi] - prefix[lo]) / (hi - lo);
+        envelope[i] = std::max(0.0f, envelope[i] - mean);
+    }
+
+    // Autocorrelation over the tempo range, weighted by a log-tempo prior
+    int minLag = std::max(1, static_cast<int>(std::floor(framesPerSecond * 60.0f / MAX_BPM)));
+    int maxLag = std::min(count / 2, static_cast<int>(std::ceil(framesPerSecond * 60.0f / MIN_BPM)));
+    std::vector<float> score(maxLag + 2, 0.0f);
+    int bestLag = minLag;
+    for (int lag = minLag; lag <= maxLag; lag++) {
+        float sum = 0.0f;
+        const float* a = envelope.data();
+        const float* b = envelope.data() + lag;
+        int n = count - lag;
+        for (int i = 0; i < n; i++) sum += a[i] * b[i];
+        float bpm = framesPerSecond * 60.0f / lag;
+        float octaves = std::log2(bpm / PREFERRED_BPM) / TEMPO_PRIOR_WIDTH;
+        score[lag] = (sum / n) * std::exp(-0.5f * octaves * octaves);
+        if (score[lag] > score[bestLag]) bestLag = lag;
+    }
+
+    // Parabolic refinement of the period
+    float period = static_cast<float>(bestLag);
+    if (bestLag > minLag && bestLag < maxLag) {
+        float l = score[bestLag - 1], c = score[bestLag], r = score[bestLag + 1];
+        float denom = l - 2.0f * c + r;
+        if (denom < 0.0f) period += 0.5f * (l - r) / denom;
+    }
+
+    // The lag grid is coarse at one beat; re-measure over several beats for a finer period
+    const int refineBeats = 4;
+    int coarse = static_cast<int>(period * refineBeats + 0.5f);
+    if (coarse + refineBeats + 1 < count / 2) {
+        float refineScore[2 * refineBeats + 3];
+        for (int k = 0; k < 2 * refineBeats + 3; k++) {
+            int lag = coarse - refineBeats - 1 + k;
+            float sum = 0.0f;
+            const float* a = envelope.data();
+            const float* b = envelope.data() + lag;
+            int n = count - lag;
+            for (int i = 0; i < n; i++) sum += a[i] * b[i];
+            refineScore[k] = sum / n;
+        }
+        int best = 1;
+        for (int k = 2; k < 2 * refineBeats + 2; k++) {
+            if (refineScore[k] > refineScore[best]) best = k;
+        }
+        float refined = static_cast<float>(coarse - refineBeats - 1 + best);
+        float l = refineScore[best - 1], c = refineScore[best], r = refineScore[best + 1];
+        float denom = l - 2.0f * c + r;
+        if (denom < 0.0f) refined += 0.5f * (l - r) / denom;
+        period = refined / refineBeats;
+    }
+    outTimeline.bpm = framesPerSecond * 60.0f / period;
+
+    // Beat phase: the grid offset that collects the most onset energy. Each grid point
+    // takes the strongest onset within the snap radius, so a slightly-off period still scores
+    int radius = std::max(1, static_cast<int>(period * 0.1f));
+    int phaseSteps = std::max(1, static_cast<int>(period));
+    int bestPhase = 0;
+    float bestPhaseScore = -1.0f;
+    for (int phase = 0; phase < phaseSteps; phase++) {
+        float sum = 0.0f;
+        for (float pos = static_cast<float>(phase); pos < count; pos += period) {
+            int center = static_cast<int>(pos);
+            float strongest = 0.0f;
+            for (int i = std::max(0, center - radius); i <= std::min(count - 1, center + radius); i++) {
+                strongest = std::max(strongest, envelope[i]);
+            }
+            sum += strongest;
+        }
+        if (sum > bestPhaseScore) {
+            bestPhaseScore = sum;
+            bestPhase = phase;
+        }
+    }
+
+    // Walk the grid from the best phase. Each beat snaps to a clear onset nearby and the
+    // next one is predicted from it, so small tempo errors don't accumulate over the track
+    float mean = 0.0f;
+    for (int i = 0; i < count; i++) mean += envelope[i];
+    mean /= count;
+    outTimeline.beats.clear();
+    outTimeline.beats.reserve(static_cast<size_t>(count / period) + 1);
+    for (float pos = static_cast<float>(bestPhase); pos < count; pos += period) {
+        int center = static_cast<int>(pos + 0.5f);
+        int best = std::min(center, count - 1);
+        for (int i = std::max(0, center - radius); i <= std::min(count - 1, center + radius); i++) {
+            if (envelope[i] > envelope[best]) best = i;
+        }
+        if (envelope[best] > 2.0f * mean) {
+            pos = static_cast<float>(best);
+        }
+        float seconds = (pos * FFT_HOP + FFT_SIZE * 0.5f) / sampleRate;
+        if (outTimeline.beats.empty() || seconds > outTimeline.beats.back()) {
+            outTimeline.beats.push_back(seconds);
+        }
+    }
+}
+
+/**
+ * Load the beat cache written next to the audio file, if it matches the file
+ */
+static bool LoadBeatCache(const std::string& cachePath, const FileStamp& source, BeatTimeline& outTimeline) {
+    FILE* file = fopen(cachePath.c_str(), "r");
+    if (!file) return false;
+
+    int version = 0;
+    FileStamp cached;
+    BeatTimeline timeline;
+    char line[128];
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] == '#') continue;
+        float value;
+        long longValue;
+        long long mtimeValue;
+        int intValue;
+        if (sscanf(line, "version %d", &intValue) == 1) {
+            version = intValue;
+        } else if (sscanf(line, "source_bytes %ld", &longValue) == 1) {
+            cached.bytes = longValue;
+        } else if (sscanf(line, "source_mtime %lld", &mtimeValue) == 1) {
+            cached.mtime = mtimeValue;
+        } else if (sscanf(line, "bpm %f", &value) == 1) {
+            timeline.bpm = value;
+        } else if (sscanf(line, "beat %f", &value) == 1) {
+            timeline.beats.push_back(value);
+        }
+    }
+    fclose(file);
+
+    if (version != BEAT_CACHE_VERSION || cached != source || timeline.beats.empty()) {
+        return false;
+    }
+    outTimeline = std::move(timeline);
+    return true;
+}
+
+static void SaveBeatCache(const std::string& cachePath, const FileStamp& source, const BeatTimeline& timeline) {
+    FILE* file = fopen(cachePath.c_str(), "w");
+    if (!file) return;
+
+    fprintf(file, "# MovieCamera beat cache\n");
+    fprintf(file, "version %d\n", BEAT_CACHE_VERSION);
+    fprintf(file, "source_bytes %ld\n", source.bytes);
+    fprintf(file, "source_mtime %lld\n", source.mtime);
+    fprintf(file, "bpm %.2f\n", timeline.bpm);
+    for (float beat : timeline.beats) {
+        fprintf(file, "beat %.4f\n", beat);
+    }
+    fclose(file);
+}
+
+bool AnalyzeBeats(const std::string& path, const std::atomic<bool>& cancel,
+                  BeatTimeline& outTimeline, std::string& outMessage) {
+    FileStamp source;
+    if (!ReadFileStamp(path, source) || source.bytes <= 0) {
+        outMessage = "cannot open file";
+        return false;
+    }
+
+    std::string cachePath = path + ".beats";
+    if (LoadBeatCache(cachePath, source, outTimeline)) {
+        outMessage = "loaded from cache";
+        return true;
+    }
+
+    WavReader wav;
+    if (!OpenWav(path, wav, outMessage)) {
+        return false;
+    }
+
+    std::vector<float> envelope;
+    if (!ComputeOnsetEnvelope(wav, cancel, envelope, outMessage)) {
+        return false;
+    }
+
+    TrackBeats(envelope, wav.sampleRate, outTimeline);
+    if (outTimeline.beats.empty()) {
+        outMessage = "no beats found";
+        return false;
+    }
+
+    SaveBeatCache(cachePath, source, outTimeline);
+    if (outMessage.empty()) outMessage = "analysed";
+    return true;
+}
+
+bool FindNearestBeat(const BeatTimeline& timeline, float minTime, float maxTime,
+                     float preferredTime, float& outBeatTime) {
+    if (timeline.beats.empty() || minTime > maxTime) return false;
+
+    float target = std::clamp(preferredTime, minTime, maxTime);
+    auto it = std::lower_bound(timeline.beats.begin(), timeline.beats.end(), target);
+
+    bool found = false;
+    float best = 0.0f;
+    if (it != timeline.beats.end() && *it <= maxTime) {
+        best = *it;
+        found = true;
+    }
+    if (it != timeline.beats.begin()) {
+        float before = *(it - 1);
+        if (before >= minTime && (!found || target - before < best - target)) {
+            best = before;
+            found = true;
+        }
+    }
+    if (found) outBeatTime = best;
+    return found;
+}
@@ -0,0 +1,49 @@
+/**
+ * BeatTracker - offline beat detection for music-synchronised cuts
+ *
+ * Decodes a local WAV file in fixed-size blocks, computes a spectral-flux
+ * onset envelope with a radix-2 FFT and estimates tempo and beat phase from
+ * the envelope's autocorrelation. All working buffers are sized up front, so
+ * memory use does not depend on the length of the track.
+ *
+ * Results are cached next to the audio file (<audio>.beats), stamped with its
+ * size and modification time, so each version of a file is only analysed once.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+/**
+ * Beat timeline of an analysed audio track
+ */
+struct BeatTimeline {
+    float bpm = 0.0f;              // Estimated tempo (beats per minute)
+    std::vector<float> beats;      // Beat times from the start of the track (seconds, ascending)
+};
+
+/**
+ * Analyse an audio file into a beat timeline
+ * Uses the cache file next to the audio if it matches, otherwise decodes and
+ * analyses the audio and writes the cache.
+ * @param path - Audio file path (PCM or float WAV)
+ * @param cancel - Set from another thread to abort the analysis
+ * @param outTimeline - Receives the beat timeline on success
+ * @param outMessage - Receives a short status or error description
+ * @return true on success
+ */
+bool AnalyzeBeats(const std::string& path, const std::atomic<bool>& cancel,
+                  BeatTimeline& outTimeline, std::string& outMessage);
+
+/**
+ * Find the beat nearest to a time, restricted to a window
+ * @param timeline - Beat timeline to search
+ * @param minTime, maxTime - Allowed window (seconds)
+ * @param preferredTime - Time to snap (seconds)
+ * @param outBeatTime - Receives the beat time
+ * @return false if no beat lies inside the window
+ */
+bool FindNearestBeat(const BeatTimeline& timeline, float minTime, float maxTime,
+                     float preferredTime, float& outBeatTime);
@@ -0,0 +1,378 @@
+/**
+ * CockpitPoi - points of interest extracted from the 3D cockpit object
+ * See CockpitPoi.h for an overview.
+ */
+
+#include "CockpitPoi.h"
+#include "FileStamp.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <cctype>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+constexpr int POI_CACHE_VERSION = 4;          // 4: entries stamped with the OBJ and .acf size and mtime
+constexpr int POI_KIND_COUNT = static_cast<int>(CockpitPoiKind::Count);
+constexpr float OVERHEAD_MARGIN = 0.10f;        // Overhead manipulators sit this far above the panel top (meters)
+constexpr float PEDESTAL_HALF_WIDTH = 0.30f;    // Pedestal manipulators sit this close to the panel centre (meters)
+constexpr int CANCEL_CHECK_LINES = 4096;
+constexpr float FEET_TO_METERS = 0.3048f;       // .acf lengths are in feet
+constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+
+struct PoiPoint {
+    float x, y, z;
+};
+
+/**
+ * Where an attached object sits on the aircraft (the conventional cockpit object needs none)
+ */
+struct ObjectPlacement {
+    float x = 0.0f, y = 0.0f, z = 0.0f;     // Offset (aircraft coordinates, meters)
+    float heading = 0.0f;                   // Rotation about the vertical axis (degrees, clockwise from above)
+};
+
+struct PoiAccumulator {
+    double x = 0.0, y = 0.0, z = 0.0;
+    long count = 0;
+
+    void add(const PoiPoint& p) {
+        x += p.x; y += p.y; z += p.z;
+        count++;
+    }
+};
+
+/**
+ * What a manipulator controls, judged from its command/dataref and tooltip
+ * @return Kind, or Count if it matches none of the clusters
+ */
+static CockpitPoiKind ClassifyManipulator(const char* line) {
+    char lower[512];
+    size_t len = std::min(std::strlen(line), sizeof(lower) - 1);
+    for (size_t i = 0; i < len; i++) lower[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(line[i])));
+    lower[len] = '\0';
+
+    if (std::strstr(lower, "fms") || std::strstr(lower, "fmc") || std::strstr(lower, "cdu")) return CockpitPoiKind::Fms;
+    if (std::strstr(lower, "autopilot")) return CockpitPoiKind::Autopilot;
+    if (std::strstr(lower, "throttle") || std::strstr(lower, "thro_") || std::strstr(lower, "mixture")) return CockpitPoiKind::Throttles;
+    if (std::strstr(lower, "radios") || std::strstr(lower, "com1") || std::strstr(lower, "com2") ||
+        std::strstr(lower, "nav1") || std::strstr(lower, "nav2") || std::strstr(lower, "transponder")) return CockpitPoiKind::Radios;
+    if (std::strstr(lower, "gear") || std::strstr(lower, "flap")) return CockpitPoiKind::GearFlaps;
+    return CockpitPoiKind::Count;
+}
+
+static bool FileExists(const std::string& path) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    fclose(file);
+    return true;
+}
+
+/**
+ * Locate the cockpit object of an aircraft
+ * X-Plane's convention is <aircraft>_cockpit.obj next to the .acf; otherwise
+ * the .acf's attached objects (_obja/<n>/...) are searched for one named like
+ * a cockpit, and its offset and heading are read with it.
+ * @param outPlacement - Receives where the object sits on the aircraft
+ * @return Path, or empty if none was found
+ */
+static std::string FindCockpitObject(const std::string& acfPath, ObjectPlacement& outPlacement) {
+    outPlacement = ObjectPlacement();
+    size_t slash = acfPath.find_last_of("/\\");
+    std::string dir = (slash != std::string::npos) ? acfPath.substr(0, slash + 1) : std::string();
+    std::string stem = acfPath.substr(dir.size());
+    size_t dot = stem.find_last_of('.');
+    if (dot != std::string::npos) stem.erase(dot);
+
+    std::string conventional = dir + stem + "_cockpit.obj";
+    if (FileExists(conventional)) return conventional;
+
+    FILE* file = fopen(acfPath.c_str(), "r");
+    if (!file) return std::string();
+    struct AttachedObject {
+        std::string name;
+        ObjectPlacement placement;
+    };
+    std::map<int, AttachedObject> attached;    // By _obja index
+    char line[512];
+    char key[128];
+    char value[384];
+    while (fgets(line, sizeof(line), file)) {
+        int index = 0, consumed = 0;
+        if (line[0] != 'P' || line[1] != ' ') continue;
+        if (sscanf(line + 2, "%127s %383s", key, value) != 2) continue;
+        if (sscanf(key, "_obja/%d/%n", &index, &consumed) != 1 || consumed == 0) continue;
+
+        const char* field = key + consumed;
+        AttachedObject& object = attached[index];
+        if (std::strcmp(field, "_v10_att_file_stl") == 0) {
+            object.name = value;
+        } else if (std::strcmp(field, "_v10_att_x_acf_prt_ref") == 0) {
+            object.placement.x = static_cast<float>(std::atof(value)) * FEET_TO_METERS;
+        } else if (std::strcmp(field, "_v10_att_y_acf_prt_ref") == 0) {
+            object.placement.y = static_cast<float>(std::atof(value)) * FEET_TO_METERS;
+        } else if (std::strcmp(field, "_v10_att_z_acf_prt_ref") == 0) {
+            object.placement.z = static_cast<float>(std::atof(value)) * FEET_TO_METERS;
+        } else if (std::strcmp(field, "_v10_att_psi_ref") == 0) {
+            object.placement.heading = static_cast<float>(std::atof(value));
+        }
+    }
+    fclose(file);
+
+    for (const auto& entry : attached) {
+        const AttachedObject& object = entry.second;
+        std::string lower = object.name;
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (lower.find("cockpit") == std::string::npos) continue;
+        for (const std::string& path : {dir + "objects/" + object.name, dir + object.name}) {
+            if (FileExists(path)) {
+                outPlacement = object.placement;
+                return path;
+            }
+        }
+    }
+    return std::string();
+}
+
+/**
+ * Parse a cockpit OBJ8 into points of interest
+ * Triangles are reduced to their centroids; panel-textured triangles
+ * (ATTR_cockpit*) and manipulator triangles (ATTR_manip_*) are collected.
+ * Vertices are placed on the aircraft as they are read, so every result is in
+ * aircraft coordinates.
+ */
+static bool ParseCockpitObject(const std::string& objPath, const ObjectPlacement& placement,
+                               const std::atomic<bool>& cancel, CockpitPois& outPois, std::string& outMessage) {
+    FILE* file = fopen(objPath.c_str(), "r");
+    if (!file) {
+        outMessage = "cannot open cockpit object";
+        return false;
+    }
+
+    std::vector<PoiPoint> vertices;
+    std::vector<int> indices;
+    std::vector<PoiPoint> panelPoints;
+    std::vector<PoiPoint> manipPoints;
+    PoiAccumulator clusters[POI_KIND_COUNT];
+    bool inPanel = false;
+    bool inManip = false;
+    CockpitPoiKind manipKind = CockpitPoiKind::Count;
+    float sinH = std::sin(placement.heading * DEG_TO_RAD), cosH = std::cos(placement.heading * DEG_TO_RAD);
+
+    char line[1024];
+    long lineCount = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (++lineCount % CANCEL_CHECK_LINES == 0 && cancel.load()) {
+            fclose(file);
+            outMessage = "cancelled";
+            return false;
+        }
+
+        const char* p = line;
+        while (*p == ' ' || *p == '\t') p++;
+
+        if (std::strncmp(p, "VT ", 3) == 0 || std::strncmp(p, "VT\t", 3) == 0) {
+            PoiPoint v;
+            if (sscanf(p + 3, "%f %f %f", &v.x, &v.y, &v.z) == 3) {
+                vertices.push_back({v.x * cosH - v.z * sinH + placement.x, v.y + placement.y,
+                                    v.x * sinH + v.z * cosH + placement.z});
+            }
+        } else if (std::strncmp(p, "IDX10", 5) == 0) {
+            int idx[10];
+            int n = sscanf(p + 5, "%d %d %d %d %d %d %d %d %d %d",
+                           &idx[0], &idx[1], &idx[2], &idx[3], &idx[4], &idx[5], &idx[6], &idx[7], &idx[8], &idx[9]);
+            indices.insert(indices.end(), idx, idx + std::max(n, 0));
+        } else if (std::strncmp(p, "IDX", 3) == 0) {
+            int idx;
+            if (sscanf(p + 3, "%d", &idx) == 1) indices.push_back(idx);
+        } else if (std::strncmp(p, "ATTR_no_cockpit", 15) == 0) {
+            inPanel = false;
+        } else if (std::strncmp(p, "ATTR_cockpit", 12) == 0) {
+            inPanel = true;
+        } else if (std::strncmp(p, "ATTR_manip_none", 15) == 0) {
+            inManip = false;
+        } else if (std::strncmp(p, "ATTR_manip_", 11) == 0) {
+            inManip = true;
+            manipKind = ClassifyManipulator(p);
+        } else if (std::strncmp(p, "TRIS", 4) == 0) {
+            int offset = 0, count = 0;
+            if (sscanf(p + 4, "%d %d", &offset, &count) != 2 || (!inPanel && !inManip)) continue;
+            for (int i = offset; i + 2 < offset + count && i + 2 < static_cast<int>(indices.size()); i += 3) {
+                int a = indices[i], b = indices[i + 1], c = indices[i + 2];
+                int vertexCount = static_cast<int>(vertices.size());
+                if (a < 0 || b < 0 || c < 0 || a >= vertexCount || b >= vertexCount || c >= vertexCount) continue;
+                PoiPoint centroid = {(vertices[a].x + vertices[b].x + vertices[c].x) / 3.0f,
+                                     (vertices[a].y + vertices[b].y + vertices[c].y) / 3.0f,
+                                     (vertices[a].z + vertices[b].z + vertices[c].z) / 3.0f};
+                if (inPanel) panelPoints.push_back(centroid);
+                if (inManip) {
+                    manipPoints.push_back(centroid);
+                    if (manipKind != CockpitPoiKind::Count) clusters[static_cast<int>(manipKind)].add(centroid);
+                }
+            }
+        }
+    }
+    fclose(file);
+
+    // Panel thirds, and overhead/pedestal clusters relative to the panel extent
+    if (!panelPoints.empty()) {
+        float minX = panelPoints[0].x, maxX = minX, minY = panelPoints[0].y, maxY = minY;
+        for (const PoiPoint& point : panelPoints) {
+            minX = std::min(minX, point.x); maxX = std::max(maxX, point.x);
+            minY = std::min(minY, point.y); maxY = std::max(maxY, point.y);
+        }
+        float third = (maxX - minX) / 3.0f;
+        float centerX = (minX + maxX) * 0.5f;
+        for (const PoiPoint& point : panelPoints) {
+            int part = std::clamp(static_cast<int>((point.x - minX) / std::max(third, 0.001f)), 0, 2);
+            clusters[static_cast<int>(CockpitPoiKind::PanelLeft) + part].add(point);
+        }
+        for (const PoiPoint& point : manipPoints) {
+            if (point.y > maxY + OVERHEAD_MARGIN) {
+                clusters[static_cast<int>(CockpitPoiKind::Overhead)].add(point);
+            } else if (point.y < minY && std::abs(point.x - centerX) < PEDESTAL_HALF_WIDTH) {
+                clusters[static_cast<int>(CockpitPoiKind::Pedestal)].add(point);
+            }
+        }
+    }
+
+    outPois = CockpitPois();
+    if (!vertices.empty()) {
+        outPois.boundsFound = true;
+        outPois.boundsMin[0] = outPois.boundsMax[0] = vertices[0].x;
+        outPois.boundsMin[1] = outPois.boundsMax[1] = vertices[0].y;
+        outPois.boundsMin[2] = outPois.boundsMax[2] = vertices[0].z;
+        for (const PoiPoint& v : vertices) {
+            outPois.boundsMin[0] = std::min(outPois.boundsMin[0], v.x); outPois.boundsMax[0] = std::max(outPois.boundsMax[0], v.x);
+            outPois.boundsMin[1] = std::min(outPois.boundsMin[1], v.y); outPois.boundsMax[1] = std::max(outPois.boundsMax[1], v.y);
+            outPois.boundsMin[2] = std::min(outPois.boundsMin[2], v.z); outPois.boundsMax[2] = std::max(outPois.boundsMax[2], v.z);
+        }
+    }
+    int foundCount = 0;
+    for (int k = 0; k < POI_KIND_COUNT; k++) {
+        if (clusters[k].count == 0) continue;
+        outPois.found[k] = true;
+        outPois.x[k] = static_cast<float>(clusters[k].x / clusters[k].count);
+        outPois.y[k] = static_cast<float>(clusters[k].y / clusters[k].count);
+        outPois.z[k] = static_cast<float>(clusters[k].z / clusters[k].count);
+        foundCount++;
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%d points of interest", foundCount);
+    outMessage = msg;
+    return foundCount > 0;
+}
+
+/**
+ * Cache lines: <object bytes> <object mtime> <acf bytes> <acf mtime> <found mask> <bounds found>
+ * <bounds min xyz> <bounds max xyz> <x y z per kind> <acf path>
+ * The .acf is stamped too: it places attached cockpit objects.
+ */
+static bool LoadPoiCache(const std::string& cachePath, const std::string& acfPath, const FileStamp& objStamp,
+                         const FileStamp& acfStamp, CockpitPois& outPois) {
+    FILE* file = fopen(cachePath.c_str(), "r");
+    if (!file) return false;
+
+    char line[1600];
+    int version = 0;
+    bool hit = false;
+    if (fgets(line, sizeof(line), file) && sscanf(line, "version %d", &version) == 1 && version == POI_CACHE_VERSION) {
+        while (!hit && fgets(line, sizeof(line), file)) {
+            char* cursor = line;
+            FileStamp obj, acf;
+            obj.bytes = std::strtol(cursor, &cursor, 10);
+            obj.mtime = std::strtoll(cursor, &cursor, 10);
+            acf.bytes = std::strtol(cursor, &cursor, 10);
+            acf.mtime = std::strtoll(cursor, &cursor, 10);
+            unsigned long mask = std::strtoul(cursor, &cursor, 10);
+            CockpitPois pois;
+            pois.boundsFound = std::strtol(cursor, &cursor, 10) != 0;
+            for (int i = 0; i < 3; i++) pois.boundsMin[i] = std::strtof(cursor, &cursor);
+            for (int i = 0; i < 3; i++) pois.boundsMax[i] = std::strtof(cursor, &cursor);
+            for (int k = 0; k < POI_KIND_COUNT; k++) {
+                pois.found[k] = (mask >> k) & 1u;
+                pois.x[k] = std::strtof(cursor, &cursor);
+                pois.y[k] = std::strtof(cursor, &cursor);
+                pois.z[k] = std::strtof(cursor, &cursor);
+            }
+            while (*cursor == ' ') cursor++;
+            std::string path = cursor;
+            path.erase(path.find_last_not_of("\r\n") + 1);
+            if (path == acfPath && obj == objStamp && acf == acfStamp) {
+                outPois = pois;
+                hit = true;
+            }
+        }
+    }
+    fclose(file);
+    return hit;
+}
+
+/**
+ * Replace the aircraft's line in the cache, keeping every other aircraft
+ */
+static void SavePoiCache(const std::string& cachePath, const std::string& acfPath, const FileStamp& objStamp,
+                         const FileStamp& acfStamp, const CockpitPois& pois) {
+    std::vector<std::string> kept;
+    FILE* file = fopen(cachePath.c_str(), "r");
+    if (file) {
+        char line[1600];
+        int version = 0;
+        if (fgets(line, sizeof(line), file) && sscanf(line, "version %d", &version) == 1 && version == POI_CACHE_VERSION) {
+            while (fgets(line, sizeof(line), file)) {
+                std::string entry = line;
+                entry.erase(entry.find_last_not_of("\r\n") + 1);
+                std::string suffix = " " + acfPath;
+                if (entry.size() < suffix.size() || entry.compare(entry.size() - suffix.size(), suffix.size(), suffix) != 0) {
+                    kept.push_back(entry);
+                }
+            }
+        }
+        fclose(file);
+    }
+
+    file = fopen(cachePath.c_str(), "w");
+    if (!file) return;
+    fprintf(file, "version %d\n", POI_CACHE_VERSION);
+    for (const std::string& entry : kept) {
+        fprintf(file, "%s\n", entry.c_str());
+    }
+    unsigned long mask = 0;
+    for (int k = 0; k < POI_KIND_COUNT; k++) {
+        if (pois.found[k]) mask |= 1ul << k;
+    }
+    fprintf(file, "%ld %lld %ld %lld %lu %d %.3f %.3f %.3f %.3f %.3f %.3f", objStamp.bytes, objStamp.mtime,
+            acfStamp.bytes, acfStamp.mtime, mask, pois.boundsFound ? 1 : 0,
+            pois.boundsMin[0], pois.boundsMin[1], pois.boundsMin[2], pois.boundsMax[0], pois.boundsMax[1], pois.boundsMax[2]);
+    for (int k = 0; k < POI_KIND_COUNT; k++) {
+        fprintf(file, " %.3f %.3f %.3f", pois.x[k], pois.y[k], pois.z[k]);
+    }
+    fprintf(file, " %s\n", acfPath.c_str());
+    fclose(file);
+}
+
+bool ExtractCockpitPois(const std::string& acfPath, const std::string& cachePath,
+                        const std::atomic<bool>& cancel, CockpitPois& outPois, std::string& outMessage) {
+    ObjectPlacement placement;
+    std::string objPath = FindCockpitObject(acfPath, placement);
+    if (objPath.empty()) {
+        outMessage = "no cockpit object";
+        return false;
+    }
+    FileStamp objStamp, acfStamp;
+    ReadFileStamp(objPath, objStamp);
+    ReadFileStamp(acfPath, acfStamp);
+    if (LoadPoiCache(cachePath, acfPath, objStamp, acfStamp, outPois)) {
+        outMessage = "cached";
+        return true;
+    }
+    if (!ParseCockpitObject(objPath, placement, cancel, outPois, outMessage)) {
+        return false;
+    }
+    SavePoiCache(cachePath, acfPath, objStamp, acfStamp, outPois);
+    return true;
+}
@@ -0,0 +1,61 @@
+/**
+ * CockpitPoi - points of interest extracted from the 3D cockpit object
+ *
+ * Reads the aircraft's cockpit OBJ once and reduces it to its bounding box and
+ * a handful of aircraft-space points: the panel-textured surfaces (split into
+ * left, centre and right thirds) and clusters of manipulators grouped by what
+ * they control (throttles, FMS, autopilot, radios, gear/flaps, overhead).
+ * Positions are static (animations are ignored) and share the origin of the
+ * acf_pe* datarefs, so they can be compared with the pilot eye directly. A
+ * cockpit attached as a misc object is moved by its .acf offset and heading.
+ *
+ * Results are cached in a single file keyed by .acf path and stamped with the
+ * size and modification time of the object and the .acf, so each aircraft is
+ * only parsed again when either file changes.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string>
+
+enum class CockpitPoiKind {
+    PanelLeft = 0,      // Left third of the panel texture surfaces
+    PanelCenter,
+    PanelRight,
+    Overhead,           // Manipulators above the top of the panel
+    Pedestal,           // Manipulators below the panel, near the centreline
+    Throttles,
+    Fms,
+    Autopilot,
+    Radios,
+    GearFlaps,
+    Count
+};
+
+/**
+ * Points of interest of one cockpit (aircraft coordinates: x right, y up, z aft)
+ */
+struct CockpitPois {
+    bool found[static_cast<int>(CockpitPoiKind::Count)] = {};
+    float x[static_cast<int>(CockpitPoiKind::Count)] = {};
+    float y[static_cast<int>(CockpitPoiKind::Count)] = {};
+    float z[static_cast<int>(CockpitPoiKind::Count)] = {};
+    bool boundsFound = false;       // Bounding box of the whole cockpit object
+    float boundsMin[3] = {};
+    float boundsMax[3] = {};
+};
+
+/**
+ * Extract the cockpit points of interest of an aircraft
+ * Uses the cache entry for the aircraft if it matches the cockpit object,
+ * otherwise parses the object and adds it to the cache.
+ * @param acfPath - Full path of the aircraft's .acf file
+ * @param cachePath - Cache file shared by all aircraft
+ * @param cancel - Set from another thread to abort the parse
+ * @param outPois - Receives the points of interest on success
+ * @param outMessage - Receives a short status or error description
+ * @return true on success
+ */
+bool ExtractCockpitPois(const std::string& acfPath, const std::string& cachePath,
+                        const std::atomic<bool>& cancel, CockpitPois& outPois, std::string& outMessage);
@@ -0,0 +1,156 @@
+/**
+ * Composition - how well a camera pose frames the aircraft
+ * See Composition.h for an overview.
+ */
+
+#include "Composition.h"
+#include "FastMath.h"
+
+#include "XPLMDataAccess.h"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr float COMPOSITION_NEAR = 0.5f;             // Corners closer than this are behind the lens (meters)
+constexpr float COMPOSITION_IDEAL_FRAMED = 0.15f;    // Ideal fraction of the frame area covered
+constexpr float COMPOSITION_COVERAGE_RANGE = 4.0f;   // Coverage score is 0 at this factor off the ideal
+constexpr float COMPOSITION_THIRDS_FALLOFF = 0.6f;   // Thirds score is 0 this far from a thirds point (NDC)
+constexpr float COMPOSITION_LEAD_TIME = 1.0f;        // Travel projected this far ahead (seconds)
+constexpr float COMPOSITION_LEAD_MIN = 0.2f;         // Part of the free space ahead that scores 0...
+constexpr float COMPOSITION_LEAD_IDEAL = 0.6f;       // ...and 1
+constexpr float COMPOSITION_ACROSS_FULL = 0.05f;     // Screen motion (NDC per lead time) at which lead room fully counts
+constexpr float COMPOSITION_WEIGHT_COVERAGE = 0.3f;
+constexpr float COMPOSITION_WEIGHT_THIRDS = 0.2f;
+constexpr float COMPOSITION_WEIGHT_HEADROOM = 0.2f;
+constexpr float COMPOSITION_WEIGHT_CLIPPING = 0.3f;
+constexpr float PI_F = 3.14159265358979f;
+
+static XPLMDataRef s_projection = nullptr;
+static bool s_live = false;
+// NDC = scale * zoom * (lateral / depth) + offset
+static float s_scaleX = 1.0f;
+static float s_scaleY = 1.0f;
+static float s_offsetX = 0.0f;
+static float s_offsetY = 0.0f;
+
+void InitComposition() {
+    s_projection = XPLMFindDataRef("sim/graphics/view/projection_matrix");
+    s_live = false;
+}
+
+void UpdateCompositionLens(float renderedZoom, float fallbackFovDeg, float fallbackAspect) {
+    // Column-major OpenGL matrix; a perspective one has -1 and 0 in its bottom row
+    float m[16];
+    if (s_projection && XPLMGetDatavf(s_projection, m, 0, 16) == 16 &&
+        std::abs(m[11] + 1.0f) < 1e-3f && std::abs(m[15]) < 1e-3f && m[0] > 0.0f && m[5] > 0.0f) {
+        float zoom = std::max(renderedZoom, 0.01f);
+        s_scaleX = m[0] / zoom;
+        s_scaleY = m[5] / zoom;
+        s_offsetX = -m[8];
+        s_offsetY = -m[9];
+        s_live = true;
+    } else if (!s_live) {
+        s_scaleX = 1.0f / std::tan(fallbackFovDeg * PI_F / 360.0f);
+        s_scaleY = s_scaleX * fallbackAspect;
+        s_offsetX = 0.0f;
+        s_offsetY = 0.0f;
+    }
+}
+
+bool IsCompositionLensLive() {
+    return s_live;
+}
+
+/**
+ * Project a point into NDC
+ * @return false if it is behind the near distance
+ */
+static bool Project(const float p[3], const XPLMCameraPosition_t& pose, const float right[3], const float up[3],
+                    const float forward[3], float sx, float sy, float& outX, float& outY) {
+    float dx = p[0] - pose.x, dy = p[1] - pose.y, dz = p[2] - pose.z;
+    float depth = dx * forward[0] + dy * forward[1] + dz * forward[2];
+    if (depth < COMPOSITION_NEAR) return false;
+    float inv = 1.0f / depth;
+    outX = sx * (dx * right[0] + dy * right[1] + dz * right[2]) * inv + s_offsetX;
+    outY = sy * (dx * up[0] + dy * up[1] + dz * up[2]) * inv + s_offsetY;
+    return true;
+}
+
+CompositionScore ScoreComposition(const CompositionSubject& subject, const XPLMCameraPosition_t& pose) {
+    CompositionScore score = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+    // Camera basis: heading 0 looks north (-Z), pitch up, roll clockwise
+    float sinH, cosH, sinP, cosP, sinR, cosR;
+    FastSinCos(pose.heading * PI_F / 180.0f, sinH, cosH);
+    FastSinCos(pose.pitch * PI_F / 180.0f, sinP, cosP);
+    FastSinCos(pose.roll * PI_F / 180.0f, sinR, cosR);
+    float forward[3] = {sinH * cosP, sinP, -cosH * cosP};
+    float levelRight[3] = {cosH, 0.0f, sinH};
+    float levelUp[3] = {-sinH * sinP, cosP, cosH * sinP};
+    float right[3], up[3];
+    for (int a = 0; a < 3; a++) {
+        right[a] = levelRight[a] * cosR - levelUp[a] * sinR;
+        up[a] = levelUp[a] * cosR + levelRight[a] * sinR;
+    }
+    float sx = s_scaleX * pose.zoom, sy = s_scaleY * pose.zoom;
+
+    // Screen rectangle spanned by the eight corners
+    float minX = 1e30f, minY = 1e30f, maxX = -1e30f, maxY = -1e30f;
+    for (int corner = 0; corner < 8; corner++) {
+        float p[3];
+        for (int a = 0; a < 3; a++) {
+            p[a] = subject.center[a] + ((corner & 1) ? subject.halfAxes[0][a] : -subject.halfAxes[0][a]) +
+                   ((corner & 2) ? subject.halfAxes[1][a] : -subject.halfAxes[1][a]) +
+                   ((corner & 4) ? subject.halfAxes[2][a] : -subject.halfAxes[2][a]);
+        }
+        float x, y;
+        if (!Project(p, pose, right, up, forward, sx, sy, x, y)) return score;   // Lens inside or beside the box
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+    }
+    float area = (maxX - minX) * (maxY - minY);
+    float insideMinX = std::max(minX, -1.0f), insideMaxX = std::min(maxX, 1.0f);
+    float insideMinY = std::max(minY, -1.0f), insideMaxY = std::min(maxY, 1.0f);
+    float inside = std::max(insideMaxX - insideMinX, 0.0f) * std::max(insideMaxY - insideMinY, 0.0f);
+    if (inside <= 0.0f || area <= 0.0f) return score;
+
+    score.framed = inside * 0.25f;
+    score.clipping = inside / area;
+    score.coverage = 1.0f - std::min(std::abs(std::log(score.framed / COMPOSITION_IDEAL_FRAMED)) /
+                                     std::log(COMPOSITION_COVERAGE_RANGE), 1.0f);
+
+    float centerX = (insideMinX + insideMaxX) * 0.5f, centerY = (insideMinY + insideMaxY) * 0.5f;
+    float offX = std::abs(centerX) - 1.0f / 3.0f, offY = std::abs(centerY) - 1.0f / 3.0f;
+    score.thirds = 1.0f - std::min(std::sqrt(offX * offX + offY * offY) / COMPOSITION_THIRDS_FALLOFF, 1.0f);
+
+    // Lead room: the share of free space on the side the aircraft moves towards,
+    // counted only as far as it moves across the screen rather than towards the lens
+    score.headroom = 1.0f;
+    float ahead[3], fromX, fromY, toX, toY;
+    for (int a = 0; a < 3; a++) {
+        ahead[a] = subject.center[a] + subject.velocity[a] * COMPOSITION_LEAD_TIME;
+    }
+    if (Project(subject.center, pose, right, up, forward, sx, sy, fromX, fromY) &&
+        Project(ahead, pose, right, up, forward, sx, sy, toX, toY)) {
+        float mx = toX - fromX, my = toY - fromY;
+        float motion = std::sqrt(mx * mx + my * my);
+        if (motion > 1e-4f) {
+            float ux = std::abs(mx) / motion, uy = std::abs(my) / motion;
+            float frontX = std::max(mx > 0.0f ? 1.0f - maxX : minX + 1.0f, 0.0f);
+            float backX = std::max(mx > 0.0f ? minX + 1.0f : 1.0f - maxX, 0.0f);
+            float frontY = std::max(my > 0.0f ? 1.0f - maxY : minY + 1.0f, 0.0f);
+            float backY = std::max(my > 0.0f ? minY + 1.0f : 1.0f - maxY, 0.0f);
+            float space = ux * (frontX + backX) + uy * (frontY + backY);
+            float share = space > 1e-4f ? (ux * frontX + uy * frontY) / space : 0.5f;
+            float lead = std::clamp((share - COMPOSITION_LEAD_MIN) / (COMPOSITION_LEAD_IDEAL - COMPOSITION_LEAD_MIN), 0.0f, 1.0f);
+            float across = std::min(motion / COMPOSITION_ACROSS_FULL, 1.0f);
+            score.headroom = 1.0f - across * (1.0f - lead);
+        }
+    }
+
+    score.total = COMPOSITION_WEIGHT_COVERAGE * score.coverage + COMPOSITION_WEIGHT_THIRDS * score.thirds +
+                  COMPOSITION_WEIGHT_HEADROOM * score.headroom + COMPOSITION_WEIGHT_CLIPPING * score.clipping;
+    return score;
+}
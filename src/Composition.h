@@ -0,0 +1,60 @@
+/**
+ * Composition - how well a camera pose frames the aircraft
+ *
+ * The aircraft's bounding box is projected through the camera in closed
+ * form (eight corners, no rendering) and the screen rectangle they span is
+ * scored on four terms: how much of the frame it covers, how close its
+ * centre sits to a rule-of-thirds point, how much room is left ahead of it
+ * in the direction it travels across the screen, and how much of it is cut
+ * off by the frame edges. Each term and the weighted total are 0..1, higher
+ * is better; a box entirely off screen or behind the camera scores 0.
+ *
+ * The lens comes from the live sim/graphics/view/projection_matrix when it
+ * holds a perspective projection (so the real aspect ratio and any
+ * off-centre projection are used), else from the camera's FOV. Sim thread only.
+ */
+
+#pragma once
+
+#include "XPLMCamera.h"
+
+/**
+ * Aircraft box in OpenGL local coordinates
+ */
+struct CompositionSubject {
+    float center[3];
+    float halfAxes[3][3];   // Half-extent vectors along the aircraft's right, up and aft axes (meters)
+    float velocity[3];      // m/s
+};
+
+struct CompositionScore {
+    float coverage;         // Frame coverage against the ideal
+    float thirds;           // Box centre near a thirds intersection
+    float headroom;         // Room ahead in the direction of travel
+    float clipping;         // Part of the box inside the frame
+    float total;            // Weighted sum of the above
+    float framed;           // Fraction of the frame area the box covers
+};
+
+/**
+ * Look up the projection matrix dataref; call once on enable
+ */
+void InitComposition();
+
+/**
+ * Sample the live projection once per frame
+ * @param renderedZoom - Camera zoom the last frame was drawn with (divided out of the live matrix)
+ * @param fallbackFovDeg - Horizontal FOV to use while no perspective projection has been seen
+ * @param fallbackAspect - Width / height for the fallback
+ */
+void UpdateCompositionLens(float renderedZoom, float fallbackFovDeg, float fallbackAspect);
+
+/**
+ * Whether the lens comes from the live projection matrix rather than the FOV
+ */
+bool IsCompositionLensLive();
+
+/**
+ * Score a camera pose (heading, pitch, roll and zoom as in XPLMCameraPosition_t)
+ */
+CompositionScore ScoreComposition(const CompositionSubject& subject, const XPLMCameraPosition_t& pose);
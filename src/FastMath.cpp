@@ -0,0 +1,184 @@
+/**
+ * FastMath - polynomial approximations for per-frame camera math
+ * See FastMath.h for an overview.
+ */
+
+#include "FastMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+constexpr float TWO_OVER_PI = 0.636619772367581f;
+// pi/2 split in three parts (Cody-Waite), so r = x - q * pi/2 stays exact for large q
+constexpr float HALF_PI_A = 1.5703125f;
+constexpr float HALF_PI_B = 4.837512969970703125e-4f;
+constexpr float HALF_PI_C = 7.54978995489188216e-8f;
+constexpr float PI_F = 3.14159265358979f;
+constexpr float HALF_PI_F = 1.57079632679490f;
+
+/**
+ * sin and cos on [-pi/4, pi/4] (Cephes single-precision minimax coefficients)
+ */
+static inline float SinKernel(float r, float r2) {
+    return r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+}
+
+static inline float CosKernel(float r2) {
+    return 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+}
+
+/**
+ * atan on [0, 1] (minimax polynomial in z^2)
+ */
+static inline float AtanKernel(float z) {
+    float z2 = z * z;
+    return z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f + z2 * (-0.11643287f + z2 * (0.05265332f + z2 * -0.01172120f)))));
+}
+
+// Bodies shared by the scalar and array variants, written without branches
+
+/**
+ * sincos by quadrant reduction to [-pi/4, pi/4]
+ */
+static inline void SinCosBody(float x, float& outSin, float& outCos) {
+    // Quadrant: nearest multiple of pi/2 (truncation of x*2/pi +- 0.5 rounds half away from zero)
+    int q = static_cast<int>(x * TWO_OVER_PI + (x >= 0.0f ? 0.5f : -0.5f));
+    float qf = static_cast<float>(q);
+    float r = ((x - qf * HALF_PI_A) - qf * HALF_PI_B) - qf * HALF_PI_C;
+    float r2 = r * r;
+    float s = SinKernel(r, r2);
+    float c = CosKernel(r2);
+
+    // Odd quadrants swap sin and cos; quadrants 2-3 negate sin, 1-2 negate cos.
+    // Signs are applied as +-1 factors so the array loop has no branches to vectorise around.
+    bool swap = (q & 1) != 0;
+    float sinValue = swap ? c : s;
+    float cosValue = swap ? s : c;
+    outSin = sinValue * static_cast<float>(1 - (q & 2));
+    outCos = cosValue * static_cast<float>(1 - ((q + 1) & 2));
+}
+
+static inline float Atan2Body(float y, float x) {
+    float ax = std::fabs(x), ay = std::fabs(y);
+    float big = std::max(ax, ay);
+    float small = std::min(ax, ay);
+    // Clamping the divisor (not selecting it) keeps the loop vectorisable; (0, 0) gives 0
+    float z = small / std::max(big, std::numeric_limits<float>::min());
+    float a = AtanKernel(z);
+    // Octant corrections as 0/1 factors: the compiler won't if-convert "c ? PI - a : a"
+    // under trapping math, but k * PI + (1 - 2k) * a is the same value for k = 0 or 1
+    float steep = ay > ax ? 1.0f : 0.0f;
+    a = steep * HALF_PI_F + (1.0f - 2.0f * steep) * a;
+    float behind = x < 0.0f ? 1.0f : 0.0f;
+    a = behind * PI_F + (1.0f - 2.0f * behind) * a;
+    return std::copysign(a, y);
+}
+
+static inline float RsqrtBody(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5f375a86u - (bits >> 1);
+    float y;
+    std::memcpy(&y, &bits, sizeof(y));
+    // Two Newton steps: ~1.7e-3 after the first, ~5e-6 after the second
+    y = y * (1.5f - 0.5f * x * y * y);
+    y = y * (1.5f - 0.5f * x * y * y);
+    return y;
+}
+
+void FastSinCos(float radians, float& outSin, float& outCos) {
+    SinCosBody(radians, outSin, outCos);
+}
+
+float FastAtan2(float y, float x) {
+    return Atan2Body(y, x);
+}
+
+float FastRsqrt(float x) {
+    return RsqrtBody(x);
+}
+
+// The no-alias promise is made on parameters, where compilers reliably honour it
+
+static void SinCosLoop(const float* __restrict radians, float* __restrict outSin, float* __restrict outCos, int count) {
+    for (int i = 0; i < count; i++) {
+        SinCosBody(radians[i], outSin[i], outCos[i]);
+    }
+}
+
+static void Atan2Loop(const float* __restrict y, const float* __restrict x, float* __restrict out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = Atan2Body(y[i], x[i]);
+    }
+}
+
+static void RsqrtLoop(const float* __restrict x, float* __restrict out, int count) {
+    for (int i = 0; i < count; i++) {
+        out[i] = RsqrtBody(x[i]);
+    }
+}
+
+void FastSinCosArray(const float* radians, float* outSin, float* outCos, int count) {
+    SinCosLoop(radians, outSin, outCos, count);
+}
+
+void FastAtan2Array(const float* y, const float* x, float* out, int count) {
+    Atan2Loop(y, x, out, count);
+}
+
+void FastRsqrtArray(const float* x, float* out, int count) {
+    RsqrtLoop(x, out, count);
+}
+
+FastMathErrors MeasureFastMathErrors(int samples) {
+    FastMathErrors errors = {0.0f, 0.0f, 0.0f};
+    samples = std::max(samples, 2);
+    std::vector<float> a(samples), b(samples), outA(samples), outB(samples);
+
+    // sin/cos: uniform over the supported range
+    for (int i = 0; i < samples; i++) {
+        a[i] = -FAST_SINCOS_RANGE + 2.0f * FAST_SINCOS_RANGE * static_cast<float>(i) / static_cast<float>(samples - 1);
+    }
+    FastSinCosArray(a.data(), outA.data(), outB.data(), samples);
+    for (int i = 0; i < samples; i++) {
+        float s, c;
+        FastSinCos(a[i], s, c);
+        double refSin = std::sin(static_cast<double>(a[i]));
+        double refCos = std::cos(static_cast<double>(a[i]));
+        double worst = std::max({std::fabs(s - refSin), std::fabs(c - refCos),
+                                 std::fabs(outA[i] - refSin), std::fabs(outB[i] - refCos)});
+        errors.sinCos = std::max(errors.sinCos, static_cast<float>(worst));
+    }
+
+    // atan2: every direction, at radii spanning six decades
+    for (int i = 0; i < samples; i++) {
+        double angle = -3.14159265358979 + 6.28318530717959 * i / (samples - 1);
+        double radius = std::pow(10.0, -3.0 + 6.0 * ((i * 7919) % samples) / samples);
+        a[i] = static_cast<float>(radius * std::sin(angle));
+        b[i] = static_cast<float>(radius * std::cos(angle));
+    }
+    FastAtan2Array(a.data(), b.data(), outA.data(), samples);
+    for (int i = 0; i < samples; i++) {
+        double ref = std::atan2(static_cast<double>(a[i]), static_cast<double>(b[i]));
+        double worst = std::max(std::fabs(FastAtan2(a[i], b[i]) - ref), std::fabs(outA[i] - ref));
+        // -pi and pi are the same direction
+        worst = std::min(worst, 6.28318530717959 - worst);
+        errors.atan2 = std::max(errors.atan2, static_cast<float>(worst));
+    }
+
+    // rsqrt: log-uniform over 1e-6 .. 1e6 (covers every mantissa many times)
+    for (int i = 0; i < samples; i++) {
+        a[i] = static_cast<float>(std::pow(10.0, -6.0 + 12.0 * i / (samples - 1)));
+    }
+    FastRsqrtArray(a.data(), outA.data(), samples);
+    for (int i = 0; i < samples; i++) {
+        double ref = 1.0 / std::sqrt(static_cast<double>(a[i]));
+        double worst = std::max(std::fabs(FastRsqrt(a[i]) - ref), std::fabs(outA[i] - ref)) / ref;
+        errors.rsqrt = std::max(errors.rsqrt, static_cast<float>(worst));
+    }
+    return errors;
+}
@@ -0,0 +1,63 @@
+/**
+ * FastMath - polynomial approximations for per-frame camera math
+ *
+ * Sine/cosine, atan2 and reciprocal square root, each with a documented
+ * maximum error that MeasureFastMathErrors() checks by sweeping the input
+ * range. The array variants are branch-free loops over contiguous floats
+ * that the compiler vectorises (4 or 8 lanes depending on the target).
+ *
+ * Nothing here replaces the standard functions implicitly: a call site uses
+ * Fast* where the bound is good enough (camera placement, where 1e-6 rad is
+ * far below a pixel) and std:: where it is not (settings, file formats).
+ */
+
+#pragma once
+
+// Maximum absolute error of FastSinCos for |radians| <= FAST_SINCOS_RANGE
+constexpr float FAST_SINCOS_RANGE = 1000.0f;
+constexpr float FAST_SINCOS_MAX_ERROR = 2e-7f;
+
+// Maximum absolute error of FastAtan2 (radians), for finite inputs where the
+// larger of |y| and |x| is not denormal
+constexpr float FAST_ATAN2_MAX_ERROR = 2.5e-6f;
+
+// Maximum relative error of FastRsqrt for normal positive floats
+constexpr float FAST_RSQRT_MAX_ERROR = 5e-6f;
+
+/**
+ * Sine and cosine of an angle in radians
+ */
+void FastSinCos(float radians, float& outSin, float& outCos);
+
+/**
+ * atan2(y, x) in radians, in [-pi, pi]; returns 0 for (0, 0)
+ */
+float FastAtan2(float y, float x);
+
+/**
+ * 1 / sqrt(x) for x > 0
+ */
+float FastRsqrt(float x);
+
+/**
+ * Array variants of the above (count elements; outputs must not overlap inputs)
+ */
+void FastSinCosArray(const float* radians, float* outSin, float* outCos, int count);
+void FastAtan2Array(const float* y, const float* x, float* out, int count);
+void FastRsqrtArray(const float* x, float* out, int count);
+
+/**
+ * Largest errors found by sweeping each function's input range against
+ * double-precision references
+ */
+struct FastMathErrors {
+    float sinCos;       // Absolute
+    float atan2;        // Absolute (radians)
+    float rsqrt;        // Relative
+};
+
+/**
+ * Sweep every function with the given number of samples per function
+ * Both the scalar and the array variants are checked; the worse one is reported.
+ */
+FastMathErrors MeasureFastMathErrors(int samples);
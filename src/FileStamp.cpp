@@ -0,0 +1,16 @@
+/**
+ * FileStamp - identity of a file version for the on-disk caches
+ * See FileStamp.h for an overview.
+ */
+
+#include "FileStamp.h"
+
+#include <sys/stat.h>
+
+bool ReadFileStamp(const std::string& path, FileStamp& outStamp) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) return false;
+    outStamp.bytes = static_cast<long>(info.st_size);
+    outStamp.mtime = static_cast<long long>(info.st_mtime);
+    return true;
+}
@@ -0,0 +1,25 @@
+/**
+ * FileStamp - identity of a file version for the on-disk caches
+ *
+ * The caches (beat timelines, model dimensions, cockpit points of interest)
+ * store the size and modification time of each source file they were derived
+ * from, and only reuse an entry while both still match.
+ */
+
+#pragma once
+
+#include <string>
+
+struct FileStamp {
+    long bytes = -1;            // -1 = file missing
+    long long mtime = 0;        // Seconds since the epoch
+
+    bool operator==(const FileStamp& other) const { return bytes == other.bytes && mtime == other.mtime; }
+    bool operator!=(const FileStamp& other) const { return !(*this == other); }
+};
+
+/**
+ * Size and modification time of a file
+ * @return false if the file does not exist
+ */
+bool ReadFileStamp(const std::string& path, FileStamp& outStamp);
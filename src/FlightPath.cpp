@@ -0,0 +1,242 @@
+/**
+ * FlightPath - where the user aircraft will be over the next minute
+ * See FlightPath.h for an overview.
+ */
+
+#include "FlightPath.h"
+
+#include "XPLMDataAccess.h"
+#include "XPLMGraphics.h"
+#include "XPLMNavigation.h"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr float REFRESH_INTERVAL = 1.0f;            // Seconds between predictions
+constexpr int MAX_WAYPOINTS = 8;                    // Route entries looked at, from the active one
+constexpr float GRAVITY_MPS2 = 9.81f;
+constexpr float MAX_BANK_DEG = 25.0f;               // Autopilot bank limit
+constexpr float STANDARD_RATE_DEG = 3.0f;           // Turn rate cap (degrees per second)
+constexpr float HAND_TURN_DECAY = 10.0f;            // Time constant of a hand-flown turn rolling out (s)
+constexpr float VS_RESPONSE_MPS2 = 1.0f;            // How fast the vertical speed reaches its target
+constexpr float MIN_GROUND_SPEED = 1.0f;            // Below this the track is the heading (m/s)
+constexpr float UNCERTAINTY_BASE = 5.0f;            // Meters at t = 0
+constexpr float UNCERTAINTY_GUIDED = 0.03f;         // Growth per meter flown under autopilot guidance
+constexpr float UNCERTAINTY_EXTRAPOLATED = 0.10f;   // Growth per meter flown without
+constexpr float FEET_TO_METERS = 0.3048f;
+constexpr float FPM_TO_MPS = 0.00508f;
+constexpr int AP_STATUS_ARMED = 1;
+constexpr int AP_STATUS_CAPTURED = 2;
+constexpr int HSI_SOURCE_GPS = 2;                   // HSI_source_select_pilot: 0 NAV1, 1 NAV2, 2 GPS
+constexpr float PI_F = 3.14159265358979f;
+
+static XPLMDataRef s_localX = nullptr;
+static XPLMDataRef s_localY = nullptr;
+static XPLMDataRef s_localZ = nullptr;
+static XPLMDataRef s_localVx = nullptr;
+static XPLMDataRef s_localVy = nullptr;
+static XPLMDataRef s_localVz = nullptr;
+static XPLMDataRef s_psi = nullptr;
+static XPLMDataRef s_magPsi = nullptr;
+static XPLMDataRef s_yawRate = nullptr;
+static XPLMDataRef s_elevation = nullptr;
+static XPLMDataRef s_servosOn = nullptr;
+static XPLMDataRef s_headingStatus = nullptr;
+static XPLMDataRef s_gpssStatus = nullptr;
+static XPLMDataRef s_navStatus = nullptr;
+static XPLMDataRef s_altHoldStatus = nullptr;
+static XPLMDataRef s_vviStatus = nullptr;
+static XPLMDataRef s_headingDial = nullptr;
+static XPLMDataRef s_altitudeDial = nullptr;
+static XPLMDataRef s_vviDial = nullptr;
+static XPLMDataRef s_hsiSource = nullptr;
+
+static FlightPathSample s_samples[FLIGHT_PATH_SAMPLES];
+static FlightPathGuidance s_guidance = FlightPathGuidance::None;
+static float s_age = 0.0f;              // Seconds since the samples were computed
+static float s_refreshTimer = 0.0f;
+
+void InitFlightPath() {
+    s_localX = XPLMFindDataRef("sim/flightmodel/position/local_x");
+    s_localY = XPLMFindDataRef("sim/flightmodel/position/local_y");
+    s_localZ = XPLMFindDataRef("sim/flightmodel/position/local_z");
+    s_localVx = XPLMFindDataRef("sim/flightmodel/position/local_vx");
+    s_localVy = XPLMFindDataRef("sim/flightmodel/position/local_vy");
+    s_localVz = XPLMFindDataRef("sim/flightmodel/position/local_vz");
+    s_psi = XPLMFindDataRef("sim/flightmodel/position/psi");
+    s_magPsi = XPLMFindDataRef("sim/flightmodel/position/mag_psi");
+    s_yawRate = XPLMFindDataRef("sim/flightmodel/position/R");
+    s_elevation = XPLMFindDataRef("sim/flightmodel/position/elevation");
+    s_servosOn = XPLMFindDataRef("sim/cockpit2/autopilot/servos_on");
+    s_headingStatus = XPLMFindDataRef("sim/cockpit2/autopilot/heading_status");
+    s_gpssStatus = XPLMFindDataRef("sim/cockpit2/autopilot/gpss_status");
+    s_navStatus = XPLMFindDataRef("sim/cockpit2/autopilot/nav_status");
+    s_altHoldStatus = XPLMFindDataRef("sim/cockpit2/autopilot/altitude_hold_status");
+    s_vviStatus = XPLMFindDataRef("sim/cockpit2/autopilot/vvi_status");
+    s_headingDial = XPLMFindDataRef("sim/cockpit2/autopilot/heading_dial_deg_mag_pilot");
+    s_altitudeDial = XPLMFindDataRef("sim/cockpit2/autopilot/altitude_dial_ft");
+    s_vviDial = XPLMFindDataRef("sim/cockpit2/autopilot/vvi_dial_fpm");
+    s_hsiSource = XPLMFindDataRef("sim/cockpit2/radios/actuators/HSI_source_select_pilot");
+    ResetFlightPath();
+}
+
+void ResetFlightPath() {
+    s_guidance = FlightPathGuidance::None;
+    s_age = 0.0f;
+    s_refreshTimer = 0.0f;
+}
+
+static int ReadInt(XPLMDataRef ref) {
+    return ref ? XPLMGetDatai(ref) : 0;
+}
+
+static float ReadFloat(XPLMDataRef ref) {
+    return ref ? XPLMGetDataf(ref) : 0.0f;
+}
+
+static float WrapDegrees(float angle) {
+    angle = std::fmod(angle + 180.0f, 360.0f);
+    return (angle < 0.0f ? angle + 360.0f : angle) - 180.0f;
+}
+
+/**
+ * Horizontal positions of the route from the active entry on
+ * @return Number of waypoints
+ */
+static int ReadRoute(float elevation, float outX[MAX_WAYPOINTS], float outZ[MAX_WAYPOINTS]) {
+    int count = XPLMCountFMSEntries();
+    int active = XPLMGetDestinationFMSEntry();
+    int found = 0;
+    for (int i = std::max(active, 0); i < count && found < MAX_WAYPOINTS; i++) {
+        XPLMNavType type = xplm_Nav_Unknown;
+        float lat = 0.0f, lon = 0.0f;
+        XPLMGetFMSEntryInfo(i, &type, nullptr, nullptr, nullptr, &lat, &lon);
+        if (type == xplm_Nav_Unknown) continue;
+        double x, y, z;
+        XPLMWorldToLocal(lat, lon, elevation, &x, &y, &z);
+        outX[found] = static_cast<float>(x);
+        outZ[found] = static_cast<float>(z);
+        found++;
+    }
+    return found;
+}
+
+/**
+ * Fly the current state forward and store the samples
+ */
+static void Predict() {
+    if (!s_localX || !s_localVx) return;
+
+    float x = XPLMGetDataf(s_localX), y = XPLMGetDataf(s_localY), z = XPLMGetDataf(s_localZ);
+    float vx = XPLMGetDataf(s_localVx), vy = XPLMGetDataf(s_localVy), vz = XPLMGetDataf(s_localVz);
+    float psi = ReadFloat(s_psi);
+    float elevation = ReadFloat(s_elevation);
+    float groundSpeed = std::sqrt(vx * vx + vz * vz);
+    // Heading 0 is north (-Z), 90 is east (+X)
+    float track = groundSpeed > MIN_GROUND_SPEED ? std::atan2(vx, -vz) * 180.0f / PI_F : psi;
+    float turnRate = ReadFloat(s_yawRate);
+
+    bool servos = ReadInt(s_servosOn) != 0;
+    float routeX[MAX_WAYPOINTS], routeZ[MAX_WAYPOINTS];
+    int waypoints = 0;
+    // GPSS always flies the route; NAV only does when the HSI is on GPS (else it tracks a VOR or localizer)
+    bool gpsNav = ReadInt(s_navStatus) == AP_STATUS_CAPTURED && ReadInt(s_hsiSource) == HSI_SOURCE_GPS;
+    if (servos && (ReadInt(s_gpssStatus) == AP_STATUS_CAPTURED || gpsNav)) {
+        waypoints = ReadRoute(elevation, routeX, routeZ);
+    }
+    bool headingCaptured = servos && ReadInt(s_headingStatus) == AP_STATUS_CAPTURED;
+    float headingBug = ReadFloat(s_headingDial) + (psi - ReadFloat(s_magPsi));     // Magnetic to true
+    s_guidance = waypoints > 0 ? FlightPathGuidance::Route
+               : headingCaptured ? FlightPathGuidance::Heading : FlightPathGuidance::Extrapolated;
+
+    // Vertical: altitude hold, else the VS bug, else the current climb or descent
+    float targetVs = vy;
+    int altHold = ReadInt(s_altHoldStatus), vvi = ReadInt(s_vviStatus);
+    if (servos && altHold == AP_STATUS_CAPTURED) {
+        targetVs = 0.0f;
+    } else if (servos && vvi == AP_STATUS_CAPTURED) {
+        targetVs = ReadFloat(s_vviDial) * FPM_TO_MPS;
+    }
+    // Only an armed altitude capture (or VS mode, which stops at the bug) levels off;
+    // a hand-flown or pitch-mode climb goes straight through the selected altitude
+    bool levelOff = servos && s_altitudeDial && (altHold == AP_STATUS_ARMED || vvi == AP_STATUS_CAPTURED);
+    float levelY = y + ReadFloat(s_altitudeDial) * FEET_TO_METERS - elevation;
+
+    float maxRate = STANDARD_RATE_DEG;
+    if (groundSpeed > MIN_GROUND_SPEED) {
+        float bankRate = GRAVITY_MPS2 * std::tan(MAX_BANK_DEG * PI_F / 180.0f) / groundSpeed * 180.0f / PI_F;
+        maxRate = std::min(maxRate, bankRate);
+    }
+    // Start turning onto the next leg one turn radius before the waypoint
+    float turnRadius = groundSpeed * 180.0f / (PI_F * std::max(maxRate, 0.1f));
+    float growth = s_guidance == FlightPathGuidance::Extrapolated ? UNCERTAINTY_EXTRAPOLATED : UNCERTAINTY_GUIDED;
+    float flown = 0.0f;
+    float decay = std::exp(-FLIGHT_PATH_STEP / HAND_TURN_DECAY);
+    int leg = 0;
+
+    for (int i = 0; i < FLIGHT_PATH_SAMPLES; i++) {
+        s_samples[i] = {x, y, z, UNCERTAINTY_BASE + growth * flown};
+
+        // Lateral
+        if (s_guidance == FlightPathGuidance::Extrapolated) {
+            track += turnRate * FLIGHT_PATH_STEP;
+            turnRate *= decay;
+        } else {
+            float desired = headingBug;
+            if (s_guidance == FlightPathGuidance::Route) {
+                float dx = routeX[leg] - x, dz = routeZ[leg] - z;
+                if (leg + 1 < waypoints && dx * dx + dz * dz < turnRadius * turnRadius) {
+                    leg++;
+                    dx = routeX[leg] - x;
+                    dz = routeZ[leg] - z;
+                }
+                desired = std::atan2(dx, -dz) * 180.0f / PI_F;
+            }
+            float turn = std::clamp(WrapDegrees(desired - track), -maxRate * FLIGHT_PATH_STEP, maxRate * FLIGHT_PATH_STEP);
+            track += turn;
+        }
+        float trackRad = track * PI_F / 180.0f;
+        x += std::sin(trackRad) * groundSpeed * FLIGHT_PATH_STEP;
+        z -= std::cos(trackRad) * groundSpeed * FLIGHT_PATH_STEP;
+
+        // Vertical, never through the altitude bug while the autopilot flies
+        float maxVsChange = VS_RESPONSE_MPS2 * FLIGHT_PATH_STEP;
+        vy += std::clamp(targetVs - vy, -maxVsChange, maxVsChange);
+        float nextY = y + vy * FLIGHT_PATH_STEP;
+        if (levelOff && (y - levelY) * (nextY - levelY) < 0.0f) {
+            nextY = levelY;
+            vy = 0.0f;
+            targetVs = 0.0f;
+        }
+        flown += std::sqrt(groundSpeed * groundSpeed + vy * vy) * FLIGHT_PATH_STEP;
+        y = nextY;
+    }
+}
+
+void UpdateFlightPath(float dt) {
+    s_age += dt;
+    s_refreshTimer -= dt;
+    if (s_refreshTimer > 0.0f) return;
+    s_refreshTimer = REFRESH_INTERVAL;
+    Predict();
+    s_age = 0.0f;
+}
+
+bool PredictFlightPath(float secondsAhead, FlightPathSample& out) {
+    if (s_guidance == FlightPathGuidance::None) return false;
+    float t = std::clamp(secondsAhead + s_age, 0.0f, FLIGHT_PATH_HORIZON);
+    float index = t / FLIGHT_PATH_STEP;
+    int i0 = std::min(static_cast<int>(index), FLIGHT_PATH_SAMPLES - 2);
+    float f = index - static_cast<float>(i0);
+    const FlightPathSample& a = s_samples[i0];
+    const FlightPathSample& b = s_samples[i0 + 1];
+    out.x = a.x + (b.x - a.x) * f;
+    out.y = a.y + (b.y - a.y) * f;
+    out.z = a.z + (b.z - a.z) * f;
+    out.uncertainty = a.uncertainty + (b.uncertainty - a.uncertainty) * f;
+    return true;
+}
+
+FlightPathGuidance GetFlightPathGuidance() {
+    return s_guidance;
+}
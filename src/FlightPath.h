@@ -0,0 +1,67 @@
+/**
+ * FlightPath - where the user aircraft will be over the next minute
+ *
+ * Once a second the current state is flown forward in 1-second steps and
+ * stored as a sampled path (OpenGL local coordinates) with an uncertainty
+ * radius that grows with time. Lateral guidance comes from, in order:
+ * the FMS route when the autopilot is coupled to it through GPSS, or NAV
+ * with the HSI on GPS (the aircraft turns towards each waypoint and
+ * sequences with a turn anticipation distance),
+ * the heading bug when heading mode is captured, or else the current turn
+ * rate, decaying as a hand-flown turn would. Vertical guidance follows the
+ * altitude hold or VS bug, levelling off at the altitude bug only when an
+ * altitude capture is armed or VS mode is flying; groundspeed
+ * is held. The uncertainty grows faster when the path is extrapolated
+ * than when the autopilot is flying it.
+ *
+ * Queries interpolate the cached samples, so they are cheap enough to run
+ * every frame. Sim thread only.
+ */
+
+#pragma once
+
+constexpr float FLIGHT_PATH_HORIZON = 60.0f;        // Seconds predicted ahead
+constexpr float FLIGHT_PATH_STEP = 1.0f;            // Seconds between samples
+constexpr int FLIGHT_PATH_SAMPLES = static_cast<int>(FLIGHT_PATH_HORIZON / FLIGHT_PATH_STEP) + 1;
+
+enum class FlightPathGuidance {
+    None,           // No prediction yet
+    Extrapolated,   // Current velocity and turn rate
+    Heading,        // Autopilot heading bug
+    Route           // Autopilot coupled to the FMS route
+};
+
+/**
+ * One predicted point
+ */
+struct FlightPathSample {
+    float x, y, z;          // OpenGL local coordinates (meters)
+    float uncertainty;      // Radius the aircraft is expected to be within (meters)
+};
+
+/**
+ * Look up the datarefs; call once on enable
+ */
+void InitFlightPath();
+
+/**
+ * Forget the current prediction (new aircraft or position)
+ */
+void ResetFlightPath();
+
+/**
+ * Advance the clock and re-predict once per second
+ */
+void UpdateFlightPath(float dt);
+
+/**
+ * Predicted position a number of seconds from now
+ * @param secondsAhead - Clamped to the prediction horizon
+ * @return false if there is no prediction yet
+ */
+bool PredictFlightPath(float secondsAhead, FlightPathSample& out);
+
+/**
+ * Guidance used for the current prediction
+ */
+FlightPathGuidance GetFlightPathGuidance();
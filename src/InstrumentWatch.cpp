@@ -0,0 +1,122 @@
+/**
+ * InstrumentWatch - low-rate change detection on cockpit controls
+ * See InstrumentWatch.h for an overview.
+ */
+
+#include "InstrumentWatch.h"
+
+#include "XPLMDataAccess.h"
+
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+
+constexpr int GROUP_COUNT = static_cast<int>(InstrumentGroup::Count);
+constexpr int MAX_SCALARS = 8;             // Scalar datarefs per group
+constexpr int CDU_LINE_BYTES = 24;
+constexpr int SCALAR_BYTES = MAX_SCALARS * static_cast<int>(sizeof(int32_t));
+constexpr int SNAPSHOT_BYTES = (CDU_LINE_BYTES > SCALAR_BYTES) ? CDU_LINE_BYTES : SCALAR_BYTES;
+constexpr float FLOAT_QUANTUM = 0.01f;     // Float changes smaller than this are ignored
+
+struct WatchedScalar {
+    const char* name;
+    XPLMDataRef ref;
+    bool isFloat;
+};
+
+static WatchedScalar s_autopilot[] = {
+    {"sim/cockpit/autopilot/autopilot_state", nullptr, false},
+    {"sim/cockpit2/autopilot/heading_mode", nullptr, false},
+    {"sim/cockpit2/autopilot/altitude_mode", nullptr, false},
+    {"sim/cockpit2/autopilot/altitude_dial_ft", nullptr, true},
+    {"sim/cockpit2/autopilot/heading_dial_deg_mag_pilot", nullptr, true},
+    {"sim/cockpit2/autopilot/airspeed_dial_kts_mach", nullptr, true},
+    {"sim/cockpit2/autopilot/vvi_dial_fpm", nullptr, true},
+};
+
+static WatchedScalar s_radios[] = {
+    {"sim/cockpit2/radios/actuators/com1_frequency_hz_833", nullptr, false},
+    {"sim/cockpit2/radios/actuators/com2_frequency_hz_833", nullptr, false},
+    {"sim/cockpit2/radios/actuators/nav1_frequency_hz", nullptr, false},
+    {"sim/cockpit2/radios/actuators/nav2_frequency_hz", nullptr, false},
+    {"sim/cockpit2/radios/actuators/transponder_code", nullptr, false},
+};
+
+static WatchedScalar s_gearFlaps[] = {
+    {"sim/cockpit2/controls/gear_handle_down", nullptr, false},
+    {"sim/cockpit2/controls/flap_handle_request_ratio", nullptr, true},
+    {"sim/cockpit2/controls/speedbrake_ratio", nullptr, true},
+};
+
+struct ScalarGroup {
+    WatchedScalar* scalars;
+    int count;
+};
+
+static const ScalarGroup s_scalarGroups[] = {
+    {s_autopilot, static_cast<int>(sizeof(s_autopilot) / sizeof(s_autopilot[0]))},
+    {s_radios, static_cast<int>(sizeof(s_radios) / sizeof(s_radios[0]))},
+    {s_gearFlaps, static_cast<int>(sizeof(s_gearFlaps) / sizeof(s_gearFlaps[0]))},
+};
+
+static XPLMDataRef s_cduTitle = nullptr;
+
+// Two snapshots per group, swapped every sample
+static unsigned char s_snapshots[2][GROUP_COUNT][SNAPSHOT_BYTES];
+static int s_current = 0;
+static bool s_haveBaseline = false;
+
+void InitInstrumentWatch() {
+    for (const ScalarGroup& group : s_scalarGroups) {
+        for (int i = 0; i < group.count; i++) {
+            group.scalars[i].ref = XPLMFindDataRef(group.scalars[i].name);
+        }
+    }
+    s_cduTitle = XPLMFindDataRef("sim/cockpit2/radios/indicators/fms_cdu1_text_line0");
+    s_haveBaseline = false;
+}
+
+void ResetInstrumentWatch() {
+    s_haveBaseline = false;
+}
+
+/**
+ * Read one scalar group into its snapshot as quantised 32-bit integers
+ */
+static void ReadScalarGroup(const ScalarGroup& group, unsigned char* out) {
+    int32_t values[MAX_SCALARS] = {};
+    for (int i = 0; i < group.count && i < MAX_SCALARS; i++) {
+        const WatchedScalar& scalar = group.scalars[i];
+        if (!scalar.ref) continue;
+        values[i] = scalar.isFloat ? static_cast<int32_t>(std::lround(XPLMGetDataf(scalar.ref) / FLOAT_QUANTUM))
+                                   : static_cast<int32_t>(XPLMGetDatai(scalar.ref));
+    }
+    std::memcpy(out, values, sizeof(values));
+}
+
+unsigned SampleInstruments() {
+    int next = 1 - s_current;
+    for (int g = 0; g < static_cast<int>(InstrumentGroup::Mcdu); g++) {
+        ReadScalarGroup(s_scalarGroups[g], s_snapshots[next][g]);
+    }
+    // Only the title line, with its digits masked: the body lines change with
+    // every clock tick, fuel figure and ETA, and page counters ("1/3") change
+    // while paging through the same page. A new title is a new page.
+    unsigned char* cdu = s_snapshots[next][static_cast<int>(InstrumentGroup::Mcdu)];
+    std::memset(cdu, 0, SNAPSHOT_BYTES);
+    if (s_cduTitle) XPLMGetDatab(s_cduTitle, cdu, 0, CDU_LINE_BYTES);
+    for (int i = 0; i < CDU_LINE_BYTES; i++) {
+        if (cdu[i] >= '0' && cdu[i] <= '9') cdu[i] = '#';
+    }
+
+    unsigned changed = 0;
+    if (s_haveBaseline) {
+        for (int g = 0; g < GROUP_COUNT; g++) {
+            size_t bytes = (g == static_cast<int>(InstrumentGroup::Mcdu)) ? CDU_LINE_BYTES : SCALAR_BYTES;
+            if (std::memcmp(s_snapshots[next][g], s_snapshots[s_current][g], bytes) != 0) changed |= 1u << g;
+        }
+    }
+    s_haveBaseline = true;
+    s_current = next;
+    return changed;
+}
@@ -0,0 +1,36 @@
+/**
+ * InstrumentWatch - low-rate change detection on cockpit controls
+ *
+ * Watched datarefs are read into one fixed snapshot buffer per control group
+ * (autopilot, radios, gear/flaps/speedbrake, MCDU page). Each sample is
+ * compared with the previous one with a single memcmp per group, so the cost
+ * does not grow with the number of values watched in a group. Floats are
+ * quantised before they are stored, so sensor noise does not count as change.
+ */
+
+#pragma once
+
+enum class InstrumentGroup {
+    Autopilot = 0,      // Engaged modes and MCP/FCU selections
+    Radios,             // COM/NAV frequencies, transponder code
+    GearFlaps,          // Gear, flap and speedbrake handles
+    Mcdu,               // CDU 1 page title (digits ignored)
+    Count
+};
+
+/**
+ * Find the watched datarefs
+ * Groups whose datarefs are missing are simply never reported.
+ */
+void InitInstrumentWatch();
+
+/**
+ * Make the next sample a fresh baseline (e.g. after an aircraft change)
+ */
+void ResetInstrumentWatch();
+
+/**
+ * Read all groups and compare with the previous sample
+ * @return Bit mask of groups that changed (bit = 1 << group); 0 for a baseline sample
+ */
+unsigned SampleInstruments();
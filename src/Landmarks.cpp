@@ -0,0 +1,257 @@
+/**
+ * Landmarks - scenic points the director can frame the aircraft against
+ * See Landmarks.h for an overview.
+ */
+
+#include "Landmarks.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+constexpr double EARTH_RADIUS_M = 6371000.0;
+constexpr double DEG_TO_RAD = 3.14159265358979323846 / 180.0;
+
+/**
+ * Position on the earth's surface (meters from the centre)
+ * The tree is stored implicitly: the node of range [lo, hi) is at its middle,
+ * split on axis, with the lower half before it and the upper half after.
+ */
+struct TreePoint {
+    float p[3];
+    int axis;
+};
+
+static std::vector<Landmark> s_landmarks;  // In tree order
+static std::vector<TreePoint> s_tree;
+
+static LandmarkSearch s_pending;
+static bool s_hasPending = false;
+static LandmarkMatch s_result;
+static bool s_hasResult = false;
+static std::mutex s_mutex;
+static std::condition_variable s_wake;
+static std::thread s_worker;
+static bool s_stopping = false;
+
+static void SurfacePoint(double latitude, double longitude, float out[3]) {
+    double lat = latitude * DEG_TO_RAD, lon = longitude * DEG_TO_RAD;
+    out[0] = static_cast<float>(EARTH_RADIUS_M * std::cos(lat) * std::cos(lon));
+    out[1] = static_cast<float>(EARTH_RADIUS_M * std::cos(lat) * std::sin(lon));
+    out[2] = static_cast<float>(EARTH_RADIUS_M * std::sin(lat));
+}
+
+static bool ParseKind(const char* text, LandmarkKind& outKind) {
+    static const struct { const char* name; LandmarkKind kind; } KINDS[] = {
+        {"peak", LandmarkKind::Peak}, {"city", LandmarkKind::City}, {"bridge", LandmarkKind::Bridge},
+        {"coast", LandmarkKind::Coast}, {"other", LandmarkKind::Other},
+    };
+    for (const auto& entry : KINDS) {
+        if (std::strcmp(text, entry.name) == 0) {
+            outKind = entry.kind;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Read "name,kind,latitude,longitude,elevation_m" rows
+ * @return Number of rows that were not blank, comments or the header but could not be read
+ */
+static int ReadCsv(FILE* file, std::vector<Landmark>& out) {
+    int rejected = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), file)) {
+        line[std::strcspn(line, "\r\n")] = '\0';
+        const char* start = line + std::strspn(line, " \t");
+        if (*start == '\0' || *start == '#' || std::strncmp(start, "name,", 5) == 0) continue;
+
+        char name[256], kind[32];
+        Landmark landmark;
+        if (sscanf(start, "%255[^,],%31[^,],%lf,%lf,%f", name, kind, &landmark.latitude, &landmark.longitude,
+                   &landmark.elevation) != 5 ||
+            !ParseKind(kind, landmark.kind) || std::abs(landmark.latitude) > 90.0 || std::abs(landmark.longitude) > 180.0) {
+            rejected++;
+            continue;
+        }
+        landmark.name = name;
+        out.push_back(std::move(landmark));
+    }
+    return rejected;
+}
+
+/**
+ * Arrange [lo, hi) of the tree (and the landmarks with it) into a k-d tree,
+ * splitting each range at its median on its widest axis
+ */
+static void BuildTree(std::vector<int>& order, int lo, int hi) {
+    if (hi - lo <= 0) return;
+    float minP[3] = {1e30f, 1e30f, 1e30f}, maxP[3] = {-1e30f, -1e30f, -1e30f};
+    for (int i = lo; i < hi; i++) {
+        for (int a = 0; a < 3; a++) {
+            minP[a] = std::min(minP[a], s_tree[order[i]].p[a]);
+            maxP[a] = std::max(maxP[a], s_tree[order[i]].p[a]);
+        }
+    }
+    int axis = 0;
+    for (int a = 1; a < 3; a++) {
+        if (maxP[a] - minP[a] > maxP[axis] - minP[axis]) axis = a;
+    }
+    int mid = (lo + hi) / 2;
+    std::nth_element(order.begin() + lo, order.begin() + mid, order.begin() + hi,
+                     [axis](int a, int b) { return s_tree[a].p[axis] < s_tree[b].p[axis]; });
+    s_tree[order[mid]].axis = axis;
+    BuildTree(order, lo, mid);
+    BuildTree(order, mid + 1, hi);
+}
+
+/**
+ * Nearest-neighbour descent: the side of the split holding the query first,
+ * the other side only if the splitting plane is closer than the best so far
+ */
+static void SearchTree(int lo, int hi, const float q[3], int exclude, int& best, float& bestD2) {
+    while (hi > lo) {
+        int mid = (lo + hi) / 2;
+        const TreePoint& node = s_tree[mid];
+        float dx = node.p[0] - q[0], dy = node.p[1] - q[1], dz = node.p[2] - q[2];
+        float d2 = dx * dx + dy * dy + dz * dz;
+        if (d2 < bestD2 && mid != exclude) {
+            bestD2 = d2;
+            best = mid;
+        }
+        float diff = q[node.axis] - node.p[node.axis];
+        if (diff < 0.0f) {
+            SearchTree(lo, mid, q, exclude, best, bestD2);
+            if (diff * diff >= bestD2) return;
+            lo = mid + 1;
+        } else {
+            SearchTree(mid + 1, hi, q, exclude, best, bestD2);
+            if (diff * diff >= bestD2) return;
+            hi = mid;
+        }
+    }
+}
+
+static void WorkerMain() {
+    for (;;) {
+        LandmarkSearch search;
+        {
+            std::unique_lock<std::mutex> lock(s_mutex);
+            s_wake.wait(lock, [] { return s_stopping || s_hasPending; });
+            if (s_stopping) return;
+            search = s_pending;
+            s_hasPending = false;
+        }
+
+        LandmarkMatch match;
+        float bestDistance = search.maxDistance;
+        for (int i = 0; i < search.count; i++) {
+            float distance;
+            int found = FindNearestLandmark(search.latitude[i], search.longitude[i], bestDistance, search.exclude, &distance);
+            if (found >= 0) {
+                bestDistance = distance;
+                match = {found, i, distance};
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result = match;
+        s_hasResult = true;
+    }
+}
+
+bool StartLandmarks(const std::string& csvPath, std::string& outMessage) {
+    StopLandmarks();
+    FILE* file = fopen(csvPath.c_str(), "r");
+    if (!file) {
+        outMessage = "no landmarks.csv";
+        return false;
+    }
+    int rejected = ReadCsv(file, s_landmarks);
+    fclose(file);
+
+    int count = static_cast<int>(s_landmarks.size());
+    s_tree.resize(count);
+    std::vector<int> order(count);
+    for (int i = 0; i < count; i++) {
+        SurfacePoint(s_landmarks[i].latitude, s_landmarks[i].longitude, s_tree[i].p);
+        order[i] = i;
+    }
+    BuildTree(order, 0, count);
+    std::vector<Landmark> landmarks(count);
+    std::vector<TreePoint> tree(count);
+    for (int i = 0; i < count; i++) {
+        landmarks[i] = std::move(s_landmarks[order[i]]);
+        tree[i] = s_tree[order[i]];
+    }
+    s_landmarks.swap(landmarks);
+    s_tree.swap(tree);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%d landmarks, %d rows skipped", count, rejected);
+    outMessage = msg;
+    if (count == 0) return false;
+
+    s_stopping = false;
+    s_hasPending = false;
+    s_hasResult = false;
+    s_worker = std::thread(WorkerMain);
+    return true;
+}
+
+void StopLandmarks() {
+    if (s_worker.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            s_stopping = true;
+        }
+        s_wake.notify_all();
+        s_worker.join();
+    }
+    s_landmarks.clear();
+    s_tree.clear();
+}
+
+int GetLandmarkCount() {
+    return static_cast<int>(s_landmarks.size());
+}
+
+const Landmark& GetLandmark(int index) {
+    return s_landmarks[index];
+}
+
+int FindNearestLandmark(double latitude, double longitude, float maxDistance, int exclude, float* outDistance) {
+    float q[3];
+    SurfacePoint(latitude, longitude, q);
+    int best = -1;
+    float bestD2 = maxDistance * maxDistance;
+    SearchTree(0, static_cast<int>(s_tree.size()), q, exclude, best, bestD2);
+    if (best >= 0 && outDistance) *outDistance = std::sqrt(bestD2);
+    return best;
+}
+
+void RequestLandmarkSearch(const LandmarkSearch& search) {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_worker.joinable()) return;
+        s_pending = search;
+        s_pending.count = std::clamp(search.count, 0, LANDMARK_SEARCH_MAX_POINTS);
+        s_hasPending = true;
+    }
+    s_wake.notify_one();
+}
+
+bool TakeLandmarkMatch(LandmarkMatch& outMatch) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_hasResult) return false;
+    outMatch = s_result;
+    s_hasResult = false;
+    return true;
+}
@@ -0,0 +1,95 @@
+/**
+ * Landmarks - scenic points the director can frame the aircraft against
+ *
+ * Peaks, cities, bridges and coastlines are read from a CSV file at enable
+ * ("name,kind,latitude,longitude,elevation_m", '#' starts a comment) and
+ * stored in a k-d tree over their position on the earth's surface, so a
+ * nearest-landmark query visits a handful of nodes rather than the whole
+ * list. Distances are horizontal (chord through the earth, which matches
+ * the great-circle distance to within a metre at these ranges).
+ *
+ * The tree is read-only once built, so FindNearestLandmark() may be called
+ * from any thread. The path search runs on a worker: the sim thread posts
+ * the predicted flight path in latitude/longitude (only it may call
+ * XPLMLocalToWorld) and later picks up the best match.
+ */
+
+#pragma once
+
+#include <string>
+
+constexpr int LANDMARK_SEARCH_MAX_POINTS = 16;     // Path points per search
+
+enum class LandmarkKind {
+    Peak,
+    City,
+    Bridge,
+    Coast,
+    Other
+};
+
+struct Landmark {
+    std::string name;
+    LandmarkKind kind;
+    double latitude;        // Degrees
+    double longitude;       // Degrees
+    float elevation;        // Top of the landmark above MSL (meters)
+};
+
+/**
+ * Points to match against the landmarks, in order along the path
+ */
+struct LandmarkSearch {
+    double latitude[LANDMARK_SEARCH_MAX_POINTS];
+    double longitude[LANDMARK_SEARCH_MAX_POINTS];
+    int count = 0;
+    float maxDistance = 0.0f;   // Landmarks further than this from every point are ignored (meters)
+    int exclude = -1;           // Landmark index to skip (e.g. the one just shown)
+};
+
+/**
+ * Landmark closest to a searched path
+ */
+struct LandmarkMatch {
+    int landmark = -1;          // Index, -1 = nothing within range
+    int point = -1;             // Path point it is closest to
+    float distance = 0.0f;      // Horizontal distance from that point (meters)
+};
+
+/**
+ * Load the landmark file, build the tree and start the search worker
+ * @param outMessage - Landmark count, or why nothing was loaded
+ * @return false if no landmarks were loaded (the worker is not started)
+ */
+bool StartLandmarks(const std::string& csvPath, std::string& outMessage);
+
+/**
+ * Stop the search worker and drop the landmarks
+ */
+void StopLandmarks();
+
+int GetLandmarkCount();
+
+/**
+ * Landmark by index (0..GetLandmarkCount()-1)
+ */
+const Landmark& GetLandmark(int index);
+
+/**
+ * Nearest landmark to a point
+ * @param exclude - Landmark index to skip, -1 = none
+ * @param outDistance - Horizontal distance to it (meters), may be null
+ * @return Landmark index, -1 if none is within maxDistance
+ */
+int FindNearestLandmark(double latitude, double longitude, float maxDistance, int exclude, float* outDistance);
+
+/**
+ * Queue a path search on the worker, replacing any search not yet started
+ */
+void RequestLandmarkSearch(const LandmarkSearch& search);
+
+/**
+ * Result of the latest finished search
+ * @return false if no search has finished since the last call
+ */
+bool TakeLandmarkMatch(LandmarkMatch& outMatch);
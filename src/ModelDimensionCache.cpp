@@ -0,0 +1,207 @@
+/**
+ * ModelDimensionCache - dimensions of loaded AI/multiplayer aircraft models
+ * See ModelDimensionCache.h for an overview.
+ */
+
+#include "ModelDimensionCache.h"
+#include "FileStamp.h"
+
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+constexpr int MODEL_CACHE_VERSION = 2;         // 2: lengths in meters, entries stamped with mtime
+constexpr float FEET_TO_METERS = 0.3048f;       // .acf lengths are in feet
+
+/**
+ * Per-index result, published by the worker
+ * dims may only be written while ready is false, and only under s_mutex by
+ * the worker whose job matches the current generation
+ */
+struct IndexEntry {
+    std::atomic<bool> ready{false};
+    unsigned generation = 0;
+    ModelDimensions dims;
+};
+
+struct ParseJob {
+    int index;
+    unsigned generation;
+    std::string path;
+};
+
+struct CachedModel {
+    FileStamp stamp;
+    ModelDimensions dims;
+};
+
+static IndexEntry s_entries[MODEL_CACHE_MAX_AIRCRAFT];
+static std::unordered_map<std::string, CachedModel> s_diskCache;   // Worker-owned while running
+static std::deque<ParseJob> s_jobs;
+static std::mutex s_mutex;
+static std::condition_variable s_wake;
+static std::thread s_worker;
+static bool s_stopping = false;
+static bool s_cacheDirty = false;
+static std::string s_cachePath;
+
+/**
+ * Parse the properties we need from an .acf file ("P <key> <value>" lines)
+ * Lengths are stored in feet and converted to meters here.
+ */
+static bool ParseAcf(const std::string& path, ModelDimensions& outDims) {
+    FILE* file = fopen(path.c_str(), "r");
+    if (!file) return false;
+
+    outDims = ModelDimensions();
+    char line[512];
+    char key[128];
+    char value[128];
+    while (fgets(line, sizeof(line), file)) {
+        if (line[0] != 'P' || line[1] != ' ') continue;
+        if (sscanf(line + 2, "%127s %127s", key, value) != 2) continue;
+
+        if (std::strcmp(key, "acf/_size_x") == 0) {
+            outDims.sizeX = static_cast<float>(std::atof(value)) * FEET_TO_METERS;
+        } else if (std::strcmp(key, "acf/_size_z") == 0) {
+            outDims.sizeZ = static_cast<float>(std::atof(value)) * FEET_TO_METERS;
+        } else if (std::strcmp(key, "acf/_peY") == 0) {
+            outDims.pilotEyeY = static_cast<float>(std::atof(value)) * FEET_TO_METERS;
+        } else if (std::strcmp(key, "acf/_ICAO") == 0) {
+            std::snprintf(outDims.icaoType, sizeof(outDims.icaoType), "%.7s", value);
+        } else {
+            size_t len = std::strlen(key);
+            if (len > 12 && std::strcmp(key + len - 12, "_semilen_JND") == 0) {
+                outDims.maxSemilen = std::max(outDims.maxSemilen, static_cast<float>(std::atof(value)) * FEET_TO_METERS);
+            }
+        }
+    }
+    fclose(file);
+    return outDims.sizeX > 0.0f || outDims.sizeZ > 0.0f || outDims.maxSemilen > 0.0f;
+}
+
+static void LoadDiskCache() {
+    s_diskCache.clear();
+    FILE* file = fopen(s_cachePath.c_str(), "r");
+    if (!file) return;
+
+    char line[1200];
+    int version = 0;
+    if (!fgets(line, sizeof(line), file) || sscanf(line, "version %d", &version) != 1 || version != MODEL_CACHE_VERSION) {
+        fclose(file);
+        return;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        CachedModel model;
+        char icao[8];
+        int consumed = 0;
+        if (sscanf(line, "%ld %lld %f %f %f %f %7s %n", &model.stamp.bytes, &model.stamp.mtime, &model.dims.sizeX,
+                   &model.dims.sizeZ, &model.dims.maxSemilen, &model.dims.pilotEyeY, icao, &consumed) != 7 ||
+            consumed == 0) {
+            continue;
+        }
+        std::snprintf(model.dims.icaoType, sizeof(model.dims.icaoType), "%s", std::strcmp(icao, "-") == 0 ? "" : icao);
+        std::string path = line + consumed;
+        path.erase(path.find_last_not_of("\r\n") + 1);
+        if (!path.empty()) s_diskCache[path] = model;
+    }
+    fclose(file);
+}
+
+static void SaveDiskCache() {
+    if (!s_cacheDirty) return;
+    FILE* file = fopen(s_cachePath.c_str(), "w");
+    if (!file) return;
+    fprintf(file, "version %d\n", MODEL_CACHE_VERSION);
+    for (const auto& item : s_diskCache) {
+        const ModelDimensions& d = item.second.dims;
+        fprintf(file, "%ld %lld %.2f %.2f %.2f %.2f %s %s\n", item.second.stamp.bytes, item.second.stamp.mtime,
+                d.sizeX, d.sizeZ, d.maxSemilen, d.pilotEyeY, d.icaoType[0] ? d.icaoType : "-", item.first.c_str());
+    }
+    fclose(file);
+    s_cacheDirty = false;
+}
+
+static void WorkerMain() {
+    for (;;) {
+        ParseJob job;
+        {
+            std::unique_lock<std::mutex> lock(s_mutex);
+            s_wake.wait(lock, [] { return s_stopping || !s_jobs.empty(); });
+            if (s_stopping) return;
+            job = std::move(s_jobs.front());
+            s_jobs.pop_front();
+        }
+
+        // The disk cache is keyed by path and invalidated by file size or modification time
+        ModelDimensions dims;
+        FileStamp stamp;
+        bool exists = ReadFileStamp(job.path, stamp);
+        bool found = false;
+        auto cached = s_diskCache.find(job.path);
+        if (exists && cached != s_diskCache.end() && cached->second.stamp == stamp) {
+            dims = cached->second.dims;
+            found = true;
+        } else if (exists && ParseAcf(job.path, dims)) {
+            s_diskCache[job.path] = {stamp, dims};
+            s_cacheDirty = true;
+            found = true;
+        }
+        if (!found) continue;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        IndexEntry& entry = s_entries[job.index];
+        if (entry.generation == job.generation) {
+            entry.dims = dims;
+            entry.ready.store(true, std::memory_order_release);
+        }
+    }
+}
+
+void StartModelDimensionCache(const std::string& cachePath) {
+    StopModelDimensionCache();
+    s_cachePath = cachePath;
+    LoadDiskCache();
+    s_stopping = false;
+    s_worker = std::thread(WorkerMain);
+}
+
+void StopModelDimensionCache() {
+    if (!s_worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_stopping = true;
+        s_jobs.clear();
+    }
+    s_wake.notify_all();
+    s_worker.join();
+    SaveDiskCache();
+}
+
+void RequestModelDimensions(int aircraftIndex, const std::string& acfPath) {
+    if (aircraftIndex <= 0 || aircraftIndex >= MODEL_CACHE_MAX_AIRCRAFT) return;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        IndexEntry& entry = s_entries[aircraftIndex];
+        entry.ready.store(false, std::memory_order_relaxed);
+        entry.generation++;
+        if (acfPath.empty() || !s_worker.joinable()) return;
+        s_jobs.push_back({aircraftIndex, entry.generation, acfPath});
+    }
+    s_wake.notify_one();
+}
+
+bool GetModelDimensions(int aircraftIndex, ModelDimensions& outDims) {
+    if (aircraftIndex <= 0 || aircraftIndex >= MODEL_CACHE_MAX_AIRCRAFT) return false;
+    const IndexEntry& entry = s_entries[aircraftIndex];
+    if (!entry.ready.load(std::memory_order_acquire)) return false;
+    outDims = entry.dims;
+    return true;
+}
@@ -0,0 +1,52 @@
+/**
+ * ModelDimensionCache - dimensions of loaded AI/multiplayer aircraft models
+ *
+ * X-Plane only publishes the acf_* datarefs for the user aircraft. For the
+ * other loaded aircraft, this cache parses each model's .acf file on a worker
+ * thread and keeps the result in a table indexed by aircraft index, so a
+ * lookup during the frame is a single array access. Parsed models are also
+ * cached on disk by path (with the file's size and modification time), so
+ * each model file is only read once.
+ */
+
+#pragma once
+
+#include <string>
+
+constexpr int MODEL_CACHE_MAX_AIRCRAFT = 64;    // Aircraft indices tracked (0 = user)
+
+/**
+ * Raw dimensions read from an .acf file, in meters (0 = not present in the file)
+ */
+struct ModelDimensions {
+    float sizeX = 0.0f;             // acf/_size_x (shadow/view width)
+    float sizeZ = 0.0f;             // acf/_size_z (shadow/view length)
+    float maxSemilen = 0.0f;        // Largest joined wing semi-length
+    float pilotEyeY = 0.0f;         // acf/_peY
+    char icaoType[8] = "";          // acf/_ICAO
+};
+
+/**
+ * Load the disk cache and start the worker thread
+ * @param cachePath - File that persists parsed models between sessions
+ */
+void StartModelDimensionCache(const std::string& cachePath);
+
+/**
+ * Stop the worker thread and write the disk cache
+ */
+void StopModelDimensionCache();
+
+/**
+ * Queue an aircraft index for parsing
+ * Replaces whatever was known about the index; safe to call repeatedly.
+ * @param aircraftIndex - XPLM aircraft index (1..MODEL_CACHE_MAX_AIRCRAFT-1)
+ * @param acfPath - Full path of the model's .acf file (empty = no model)
+ */
+void RequestModelDimensions(int aircraftIndex, const std::string& acfPath);
+
+/**
+ * Look up the dimensions of an aircraft index
+ * @return false while the model is still being parsed, or if it has none
+ */
+bool GetModelDimensions(int aircraftIndex, ModelDimensions& outDims);
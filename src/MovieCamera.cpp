@@ -22,10 +22,25 @@
 #include "XPLMCamera.h"
 #include "XPLMGraphics.h"
 #include "XPLMUtilities.h"
+#include "XPLMScenery.h"
+#include "XPLMPlanes.h"
 
 #include "ImgWindow.h"
 #include "imgui.h"
 
+#include "BeatTracker.h"
+#include "TrafficTracker.h"
+#include "ModelDimensionCache.h"
+#include "CockpitPoi.h"
+#include "InstrumentWatch.h"
+#include "Profiling.h"
+#include "ShotColumns.h"
+#include "FastMath.h"
+#include "Arena.h"
+#include "FlightPath.h"
+#include "Landmarks.h"
+#include "Composition.h"
+
 // OpenGL for trajectory drawing
 #if IBM
 #include <windows.h>
@@ -41,10 +56,15 @@
 #include <cmath>
 #include <ctime>
 #include <cstdio>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <algorithm>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <string_view>
+#include <unordered_map>
 
 // Plugin Info
 #define PLUGIN_NAME        "MovieCamera"
@@ -75,6 +95,15 @@ enum class CameraType {
     External
 };
 
+// How the camera moves during a shot
+enum class ShotMotion {
+    Drift,    // Linear drift in aircraft space
+    Orbit,    // Closed-form circle around a look-at target
+    TwoShot,  // Framing solved per frame to hold the subject and a second aircraft
+    Wingman,  // Camera body with its own dynamics flying a formation slot
+    Landmark  // Aircraft framed against a landmark behind it
+};
+
 enum class WingspanSource {
     Auto = 0,
     AcfSizeX = 1,
@@ -106,6 +135,41 @@ enum class DebugShotType {
     External = 2
 };
 
+// Flight phase, classified from low-rate samples with hysteresis
+enum class FlightPhase {
+    Parked = 0,
+    Taxi,
+    TakeoffRoll,
+    InitialClimb,
+    Cruise,
+    Descent,
+    Approach,
+    LandingRoll,
+    Count
+};
+
+// When auto mode may take the camera in a given phase
+enum class AutoActivation {
+    Never,                // Pilot is busy - leave the view alone
+    Always,               // Activate as soon as the phase is entered
+    WhenIdleAboveAutoAlt  // Activate after the mouse delay, above the Auto Alt setting
+};
+
+// Where a traffic airframe's cached dimensions came from, least to most accurate
+enum class DimsSource {
+    Default = 0,    // Standard dimensions, nothing known yet
+    IcaoType,       // Estimated from the TCAS ICAO type
+    Model           // Parsed from the loaded .acf model
+};
+
+enum class TransitionStyle {
+    Auto = 0,       // Pick a motivated style from the shot pair
+    Cut = 1,        // Instant switch
+    WhipPan = 2,    // Fast pan away, cut hidden at the blur peak, overshoot into the new shot
+    PushPull = 3,   // Push-in / pull-out along a path that avoids the aircraft
+    MatchCut = 4    // Instant switch keeping the aircraft at the same screen position
+};
+
 struct CameraShot {
     CameraType type;
     float x, y, z;           // Position offset from aircraft
@@ -118,6 +182,19 @@ struct CameraShot {
     float driftX, driftY, driftZ;          // Position drift per second
     float driftPitch, driftHeading, driftRoll;  // Rotation drift per second
     float driftZoom;                        // Zoom drift per second (for cockpit)
+    
+    // Orbit parameters (only used when motion == ShotMotion::Orbit)
+    ShotMotion motion = ShotMotion::Drift;
+    float orbitRadius = 0.0f;               // Distance from look-at target (meters)
+    float orbitElevation = 0.0f;            // Elevation angle above the target (degrees)
+    float orbitRate = 0.0f;                 // Angular speed (degrees per second, sign = default direction)
+    float orbitStartAzimuth = 0.0f;         // Start azimuth relative to aircraft nose (degrees, clockwise)
+    float orbitTargetX = 0.0f;              // Look-at target in aircraft coordinates
+    float orbitTargetY = 0.0f;
+    float orbitTargetZ = 0.0f;
+    
+    // Flight phases this shot belongs to (bit per FlightPhase)
+    unsigned phaseMask = ~0u;
 };
 
 // Aircraft dimension constants
@@ -151,6 +228,137 @@ constexpr float EASE_IN_DURATION_RATIO = 0.3f;            // Ratio of shot durat
 constexpr float CLOSE_DISTANCE_SCALE = 0.8f;              // Scale factor for close-up camera distances
 constexpr float DRIFT_DISTANCE_MULTIPLIER = 1.8f;
 
+// Transition constants
+constexpr int TRANSITION_TABLE_SIZE = 33;                 // Samples in the precomputed transition table
+constexpr float WHIP_PAN_DURATION = 0.6f;                 // Whip-pans are always fast (seconds)
+constexpr float WHIP_PAN_ANGLE_DEG = 70.0f;               // Heading swing on each side of the hidden cut
+constexpr float WHIP_PAN_OVERSHOOT = 1.70158f;            // Overshoot amount for the settle into the new shot
+constexpr float MATCH_CUT_MAX_CORRECTION_DEG = 25.0f;     // Max aim correction a match cut may apply
+constexpr float PUSH_SAFETY_MARGIN = 1.3f;                // Inflation of the aircraft ellipsoid for push/pull paths
+constexpr float PUSH_DISTANCE_RATIO = 1.4f;               // Distance change that motivates a push-in/pull-out
+
+// Flight phase classifier constants
+constexpr float PHASE_SAMPLE_INTERVAL = 0.5f;             // Seconds between classifier samples
+constexpr int PHASE_CONFIRM_SAMPLES = 3;                  // Consecutive samples before a phase change is accepted
+constexpr float PHASE_TAXI_ENTER_KT = 3.0f;               // Ground speed to start taxiing
+constexpr float PHASE_TAXI_EXIT_KT = 1.0f;                // Ground speed to count as parked again
+constexpr float PHASE_ROLL_ENTER_KT = 40.0f;              // Ground speed for a takeoff roll
+constexpr float PHASE_ROLL_EXIT_KT = 30.0f;               // Below this a roll (takeoff or landing) becomes taxi
+constexpr float PHASE_CLIMB_EXIT_AGL_FT = 3000.0f;        // Initial climb ends above this height
+constexpr float PHASE_DESCENT_ENTER_FPM = -500.0f;        // Sustained descent rate to leave cruise
+constexpr float PHASE_DESCENT_EXIT_FPM = -200.0f;         // Descent rate above which we are cruising again
+constexpr float PHASE_APPROACH_ENTER_AGL_FT = 2500.0f;    // Descending below this height is an approach
+constexpr float PHASE_APPROACH_EXIT_AGL_FT = 3500.0f;     // Climbing above this height leaves the approach
+constexpr float PHASE_GO_AROUND_FPM = 500.0f;             // Climb rate on approach treated as a go-around
+constexpr float PHASE_LEVEL_FPM = 300.0f;                 // Vertical speed within this counts as level flight
+constexpr float PHASE_LEVEL_SECONDS = 30.0f;              // Level this long after takeoff is cruise, whatever the height
+constexpr float MPS_TO_KT = 1.94384f;
+constexpr float M_TO_FT = 3.28084f;
+
+// Beat sync constants
+constexpr int BEAT_PATH_MAX = 512;                        // Max length of the audio path setting
+
+// Spectator constants
+constexpr float SPECTATOR_MAX_RANGE_M = 30000.0f;         // Nearest-target pick ignores traffic further away
+constexpr float SPECTATOR_IDENTITY_INTERVAL = 2.0f;       // Seconds between flight ID/type refreshes
+constexpr float TRAFFIC_OCCLUSION_RADIUS = 40.0f;         // Traffic this close to the line of sight blocks a shot (meters)
+constexpr int SHOT_OCCLUSION_MAX_HITS = 4;
+
+// Target director constants
+constexpr float DIRECTOR_SCORE_INTERVAL = 1.0f;           // Each target is rescored about once per interval (seconds)
+constexpr float DIRECTOR_MIN_DWELL = 20.0f;               // Minimum time on a subject before the director moves on
+constexpr float DIRECTOR_SWITCH_MARGIN = 1.25f;           // A challenger must beat the current subject by this factor
+constexpr float DIRECTOR_FRESHNESS_TIME = 180.0f;         // Seconds after being shown until a target is fully fresh again
+constexpr float DIRECTOR_FORGET_TIME = 5.0f;              // Targets missing from TCAS this long are dropped
+constexpr float DIRECTOR_CLOSING_SPEED_MPS = 60.0f;       // Closing speed that earns the full closing score
+constexpr float DIRECTOR_TERRAIN_INTERVAL = 5.0f;         // Seconds between terrain probes under a target (for its AGL)
+
+// Two-shot constants
+constexpr float TWO_SHOT_CHANCE = 0.3f;                   // Chance of a two-shot when a partner is in range
+constexpr float TWO_SHOT_MAX_SEPARATION = 1500.0f;        // Partner must be this close to the subject (meters)
+constexpr float TWO_SHOT_MAX_DISTANCE = 3000.0f;          // Furthest the camera may stand from the pair (meters)
+constexpr float TWO_SHOT_FILL = 0.7f;                     // Part of the half-frame the pair may occupy
+constexpr float TWO_SHOT_ELEVATION_DEG = 10.0f;           // Camera elevation above the pair
+constexpr float TWO_SHOT_MAX_AZIMUTH_DEG = 35.0f;         // Random swing off the broadside view
+constexpr float TWO_SHOT_SMOOTHING = 1.2f;                // Time constant of the framing smoothing (seconds)
+constexpr float TWO_SHOT_MIN_ZOOM = 0.5f;
+constexpr float TWO_SHOT_MAX_ZOOM = 4.0f;
+constexpr float SCREEN_ASPECT = 16.0f / 9.0f;             // Matches the vertical FOV written by SetFovImmediate
+
+// Composition constants
+constexpr float COMPOSITION_WEIGHT_FLOOR = 0.05f;         // Selection weight of an exterior shot that frames nothing
+constexpr float COMPOSITION_POOR_SCORE = 0.15f;           // Below this the aircraft is essentially out of the frame
+constexpr float COMPOSITION_POOR_CUT_TIME = 1.5f;         // Seconds of poor composition before the shot is cut short
+
+// Landmark constants
+constexpr float LANDMARK_SEARCH_INTERVAL = 5.0f;          // Seconds between searches along the predicted path
+constexpr float LANDMARK_SEARCH_STEP = 10.0f;             // Seconds between the path points searched
+constexpr float LANDMARK_NEAR_PATH_M = 6000.0f;           // A landmark this close to the path is worth a shot
+constexpr float LANDMARK_MATCH_LIFETIME = 15.0f;          // Seconds a match stays usable
+constexpr float LANDMARK_MIN_RANGE_M = 800.0f;            // Closer than this, the landmark fills the frame
+constexpr float LANDMARK_MAX_RANGE_M = 25000.0f;          // Further than this, it is lost in the haze
+constexpr float LANDMARK_SHOT_CHANCE = 0.5f;              // Chance of a landmark shot at an exterior cut
+constexpr float LANDMARK_CAMERA_SPANS = 2.5f;             // Camera distance behind the aircraft (wingspans)
+constexpr float LANDMARK_MIN_CAMERA_DISTANCE = 25.0f;
+constexpr float LANDMARK_MAX_CAMERA_DISTANCE = 150.0f;
+constexpr float LANDMARK_CAMERA_ELEVATION_DEG = 5.0f;     // Lowest camera elevation above the aircraft
+constexpr float LANDMARK_MAX_CAMERA_ELEVATION_DEG = 60.0f;
+constexpr float LANDMARK_FRAME_SPREAD = 1.0f;             // Landmark placed this far below the aircraft (vertical half-frames)
+constexpr float LANDMARK_MAX_SPREAD = 1.4f;               // Furthest apart they still both fit (vertical half-frames)
+constexpr float LANDMARK_MAX_SWING_DEG = 25.0f;           // Swing off the landmark-aircraft line
+constexpr float LANDMARK_AIM_BLEND = 0.4f;                // Aim this far from the aircraft towards the landmark
+constexpr float LANDMARK_AIM_MAX_OFFSET = 0.6f;           // ...but keep the aircraft within this part of the half-frame
+
+// Wingman constants
+constexpr float WINGMAN_NATURAL_FREQ = 0.6f;              // Slot-keeping response (rad/s)
+constexpr float WINGMAN_DAMPING = 0.8f;                   // Slot-keeping damping ratio (slightly underdamped)
+constexpr float WINGMAN_MAX_ACCEL = 5.0f;                 // Camera body acceleration limit (m/s^2)
+constexpr float WINGMAN_MAX_TURN_RATE = 6.0f * PI / 180.0f;  // Camera body turn rate limit (rad/s)
+constexpr float WINGMAN_MIN_TURN_SPEED = 20.0f;           // Speed assumed for the turn limit when slower (m/s)
+constexpr float WINGMAN_JOIN_DISTANCE = 25.0f;            // Shot opens this far behind the slot and closes in (meters)
+constexpr float WINGMAN_WANDER = 1.5f;                    // Amplitude of the slow slot wander (meters)
+constexpr float WINGMAN_WANDER_RATE = 0.45f;              // Wander clock speed (rad/s)
+constexpr float WINGMAN_BANK_FOLLOW = 0.5f;               // Part of the body's bank the camera shows
+constexpr float GRAVITY = 9.81f;
+
+// Cockpit point-of-interest constants
+constexpr float COCKPIT_POI_MIN_DISTANCE = 0.15f;         // Closer POIs are too near the camera to aim at (meters)
+
+// Instrument cue constants
+constexpr float INSTRUMENT_SAMPLE_INTERVAL = 0.5f;        // Seconds between control snapshots
+constexpr float INSTRUMENT_CUE_LIFETIME = 10.0f;          // A cue not taken by then is dropped (seconds)
+constexpr float INSTRUMENT_CUT_COOLDOWN = 20.0f;          // Minimum time between instrument-driven shots
+constexpr float INSTRUMENT_MIN_SHOT_TIME = 3.0f;          // The current shot runs at least this long before a cue cuts it
+
+// Cockpit volume constants (distances from the pilot eye, times the cockpit scale)
+constexpr float COCKPIT_VOLUME_FORWARD = 0.70f;           // Panel face ahead of the eye
+constexpr float COCKPIT_VOLUME_AFT = 0.45f;               // Seat back behind the eye
+constexpr float COCKPIT_VOLUME_UP = 0.40f;                // Ceiling above the eye
+constexpr float COCKPIT_VOLUME_DOWN = 0.45f;              // Seat cushion / pedestal top below the eye
+constexpr float COCKPIT_VOLUME_MIN_HALF_WIDTH = 0.45f;    // Half cabin width when the eye is on the centreline
+constexpr float COCKPIT_WALL_MARGIN = 0.08f;              // Keep this far inside the cockpit object bounds (meters)
+constexpr float COCKPIT_SOFT_ZONE = 0.10f;                // Width of the soft boundary (meters)
+constexpr int COCKPIT_VOLUME_MAX_PLANES = 8;
+
+// Pilot head anchor constants
+constexpr float HEAD_ANCHOR_SMOOTHING_TIME = 0.4f;        // Time constant of the head position filter (seconds)
+constexpr float HEAD_ANCHOR_MAX_OFFSET = 1.0f;            // Head positions further than this from acf_pe* are ignored (meters)
+constexpr float HEAD_RESUME_MAX_DISTANCE = 1.5f;          // Resume blends from the user's view only if it is this close to the head
+
+// Fixed-timestep constants
+constexpr float FIXED_STEP = 1.0f / 120.0f;               // Simulation step for camera dynamics (seconds)
+constexpr int FIXED_STEP_MAX_PER_FRAME = 12;              // Longer frames drop time instead of spiralling
+
+// Startup constants
+constexpr double STARTUP_TIME_BUDGET_MS = 100.0;          // XPluginStart + XPluginEnable beyond this logs a warning
+
+// Settings profile constants
+constexpr int PROFILE_COMMAND_SLOTS = 9;                  // MovieCamera/profile/1 .. /9
+
+// Orbit constants
+constexpr float ORBIT_MAX_SUN_OFFSET_DEG = 90.0f;         // Max angle between camera bearing and sun at orbit start
+constexpr float ORBIT_MIN_SUN_PITCH_DEG = -5.0f;          // Below this sun pitch, ignore the sun when planning orbits
+
 /**
  * Aircraft dimensions structure
  * Stores dimensions read from X-Plane datarefs to calculate dynamic camera positions
@@ -179,8 +387,9 @@ struct AircraftDimensions {
     }
 };
 
-// Global aircraft dimensions
+// Global aircraft dimensions (of the current camera subject)
 static AircraftDimensions g_aircraftDims;
+static AircraftDimensions g_userAircraftDims;    // The user aircraft, kept while spectating traffic
 
 // Plugin Global State
 static PluginMode g_pluginMode = PluginMode::Off;
@@ -201,6 +410,51 @@ static float g_manualHeight = STANDARD_HEIGHT;
 static DebugShotType g_debugShotType = DebugShotType::Auto;
 static int g_debugShotIndex = -1;
 
+// Settings schema
+// One row per persisted setting drives parsing, saving, clamping and the
+// settings widget, so a new setting is a single table entry.
+enum class SettingType {
+    Bool,
+    Int,
+    Enum,       // enum class with int storage; the range is its value count
+    Float,
+    Text        // char array of textSize bytes
+};
+
+enum class SettingWidget {
+    None,
+    Checkbox,
+    Slider,
+    Input,
+    Combo       // Enum settings; items is a '\0'-separated list
+};
+
+struct SettingDef {
+    const char* key;            // settings.cfg key
+    SettingType type;
+    void* value;
+    float minValue, maxValue;
+    float defaultValue;
+    const char* format;         // Float precision in settings.cfg and the widget
+    SettingWidget widget;
+    const char* label;          // Widget label (ImGui id after ##)
+    float step;                 // Input step (the fast step is 10x)
+    const char* items;          // Combo items
+    size_t textSize;
+};
+
+// Named profiles: setting values applied over the current settings
+// Values are kept as text and parsed by the schema when a profile is applied.
+struct SettingsProfile {
+    std::string name;
+    std::vector<std::pair<const SettingDef*, std::string>> values;
+};
+static std::vector<SettingsProfile> g_profiles;
+static int g_activeProfile = -1;            // -1 = settings edited since the last profile
+static XPLMCommandRef g_cmdProfileNext = nullptr;
+static XPLMCommandRef g_cmdProfilePrevious = nullptr;
+static XPLMCommandRef g_cmdProfileSlots[PROFILE_COMMAND_SLOTS] = {};
+
 // Mouse tracking
 static int g_lastMouseX = 0;
 static int g_lastMouseY = 0;
@@ -214,13 +468,308 @@ static int g_consecutiveSameTypeCount = 0;
 static CameraType g_lastShotType = CameraType::Cockpit;
 static CameraShot g_currentShot;           // Store current shot for drift calculation
 
+/**
+ * Per-frame pose of one kind of shot (see ChooseShotEvaluator)
+ */
+using ShotEvaluator = void (*)(const CameraShot& shot, float elapsed,
+                               float acfX, float acfY, float acfZ,
+                               float acfHeading, float acfPitch, float acfRoll,
+                               XPLMCameraPosition_t* outCameraPosition);
+static ShotEvaluator g_currentShotEvaluator = nullptr;    // Chosen with g_currentShot at each cut
+
+/**
+ * Orbit state precomputed when an orbit shot is selected
+ * Per-frame evaluation only needs one sincos for the azimuth and one for the heading
+ */
+struct OrbitState {
+    float startAzimuth;      // Start azimuth relative to aircraft nose (radians)
+    float angularRate;       // Signed angular speed (radians per second)
+    float horizontalRadius;  // radius * cos(elevation)
+    float verticalOffset;    // radius * sin(elevation)
+    float elevationDeg;      // Elevation angle (degrees), camera pitch is the negative of this
+};
+static OrbitState g_orbit = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+// Two-shot state
+// The framing is solved every frame as an offset from the pair's midpoint plus
+// a zoom; only those two are smoothed, so the camera never lags the aircraft
+// themselves, only the changes in their layout.
+struct TwoShotState {
+    int partnerModeS;       // Second aircraft (0 = the user aircraft, while spectating traffic)
+    float partnerRadius;    // Bounding sphere radius of the partner (meters)
+    float side;             // +1/-1: which side of the pair the camera stands on
+    float azimuthOffset;    // Swing off the broadside view (radians)
+    float offsetX;          // Smoothed camera offset from the midpoint (meters)
+    float offsetY;
+    float offsetZ;
+    float zoom;             // Smoothed zoom
+};
+static TwoShotState g_twoShot = {0, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+// Composition of the active shot
+// The pose the camera callback wrote is scored once per frame; an exterior shot
+// that loses the aircraft for long is cut short.
+struct CompositionState {
+    XPLMCameraPosition_t lastPose;  // Last pose written by the camera callback
+    bool posed;                     // lastPose is valid
+    CompositionScore score;         // Score of lastPose
+    float poorTime;                 // Seconds the score has been below COMPOSITION_POOR_SCORE
+};
+static CompositionState g_composition = {};
+
+// Landmark shots
+// Every few seconds the predicted flight path is handed to the landmark worker;
+// its latest match lets the next exterior cut frame the aircraft against that
+// landmark. The landmark's local position is re-converted every frame, since
+// the local origin moves with the aircraft.
+struct LandmarkShotState {
+    float searchTimer;
+    LandmarkMatch match;    // Latest search result (landmark -1 = none)
+    float matchAge;         // Seconds since the match arrived
+    int landmark;           // Landmark of the current or last landmark shot (-1 = none yet)
+    float x, y, z;          // Its local position (meters)
+    float swing;            // Camera swing off the landmark-aircraft line (degrees)
+};
+static bool g_enableLandmarkShots = true;
+static bool g_landmarksLoaded = false;
+static std::string g_landmarkMessage;
+static LandmarkShotState g_landmarkShot = {0.0f, LandmarkMatch(), 0.0f, -1, 0.0f, 0.0f, 0.0f, 0.0f};
+
+// Wingman state
+// A point-mass camera body chasing a formation slot with bounded acceleration
+// and turn rate. It is stepped at FIXED_STEP, so it moves the same at any
+// frame rate; the pose in between steps is extrapolated along the velocity.
+struct WingmanState {
+    float x, y, z;          // Camera body position (local coordinates)
+    float vx, vy, vz;       // Velocity (m/s)
+    float ax, ay, az;       // Acceleration of the last step (drives the bank)
+    float accumulator;      // Time not yet stepped (seconds, < FIXED_STEP)
+    float wanderPhase;      // Slot wander clock (radians)
+};
+static WingmanState g_wingman = {};
+
 // Smooth transition state
+// Start/target poses are kept in the aircraft's heading-stabilised frame so the
+// transition travels with the aircraft instead of being left behind in world space
+struct TransitionSample {
+    float weight;                       // Blend from start pose (0) to target pose (1)
+    float detourX, detourY, detourZ;    // Safe-path offset around the aircraft (meters)
+    float headingOffset, pitchOffset;   // Extra rotation on top of the blend (degrees)
+};
+static TransitionSample g_transitionTable[TRANSITION_TABLE_SIZE];
+static TransitionStyle g_transitionStyle = TransitionStyle::Auto;         // User setting
+static TransitionStyle g_activeTransitionStyle = TransitionStyle::Cut;    // Resolved style of the running transition
 static float g_transitionProgress = 0.0f;
-static float g_transitionDuration = 1.0f;  // 1 second transition
+static float g_transitionDuration = 1.0f;  // Push/pull and match cut length (seconds)
+static float g_activeTransitionDuration = 1.0f;
 static XPLMCameraPosition_t g_startPos;
 static XPLMCameraPosition_t g_targetPos;
 static bool g_inTransition = false;
 
+/**
+ * Per-phase director policy: which shots fit, how fast to cut, when auto mode may start
+ */
+struct PhasePolicy {
+    const char* name;
+    float cockpitChance;          // Probability of picking cockpit when the type may switch
+    float durationScale;          // Pacing: multiplier on the random shot duration
+    AutoActivation autoActivation;
+};
+
+static const PhasePolicy g_phasePolicies[static_cast<int>(FlightPhase::Count)] = {
+    {"Parked",        0.3f, 1.2f, AutoActivation::Always},
+    {"Taxi",          0.4f, 1.0f, AutoActivation::Never},
+    {"Takeoff Roll",  0.3f, 0.6f, AutoActivation::Never},
+    {"Initial Climb", 0.4f, 0.8f, AutoActivation::Never},
+    {"Cruise",        0.5f, 1.3f, AutoActivation::WhenIdleAboveAutoAlt},
+    {"Descent",       0.5f, 1.1f, AutoActivation::WhenIdleAboveAutoAlt},
+    {"Approach",      0.5f, 0.8f, AutoActivation::Never},
+    {"Landing Roll",  0.3f, 0.6f, AutoActivation::Never},
+};
+
+/**
+ * Flight phase classifier state (exposed in the settings window for debugging)
+ */
+struct FlightPhaseState {
+    FlightPhase phase;            // Confirmed phase
+    FlightPhase candidate;        // Phase the latest samples point to
+    int candidateSamples;         // Consecutive samples agreeing with candidate
+    float sampleTimer;            // Time since last sample
+    bool onGround;                // Last sample inputs
+    float groundSpeedKt;
+    float verticalSpeedFpm;
+    float aglFt;
+    float levelSeconds;           // Time vertical speed has stayed within PHASE_LEVEL_FPM
+};
+static FlightPhaseState g_flightPhase = {FlightPhase::Parked, FlightPhase::Parked, 0, 0.0f, true, 0.0f, 0.0f, 0.0f, 0.0f};
+
+// Beat-synchronised cuts
+// The worker thread owns g_beatTimeline/g_beatMessage while g_beatState is Running;
+// the sim thread only reads them once it observes Ready or Failed
+enum class BeatAnalysisState {
+    Idle,
+    Running,
+    Ready,
+    Failed
+};
+static bool g_enableBeatSync = false;
+static char g_beatAudioPath[BEAT_PATH_MAX] = "";
+static float g_beatOffset = 0.0f;          // Track time (seconds) at the moment camera control starts
+static float g_musicClock = 0.0f;          // Seconds since camera control started
+static std::thread g_beatWorker;
+static std::atomic<bool> g_beatCancel{false};
+static std::atomic<BeatAnalysisState> g_beatState{BeatAnalysisState::Idle};
+static BeatTimeline g_beatTimeline;
+static std::string g_beatMessage;
+
+// Instrument cues
+// A change on a watched control group queues a cue; the director cuts to the
+// cockpit shot framing that control (or takes it at the next cut).
+struct InstrumentCueState {
+    float sampleTimer;
+    int group;              // Cued InstrumentGroup (-1 = none)
+    float age;              // Seconds since the cue was raised
+    float cooldown;         // Seconds until another cue may be raised
+};
+static bool g_enableInstrumentCues = true;
+static InstrumentCueState g_instrumentCue = {0.0f, -1, 0.0f, 0.0f};
+
+// Cockpit interior volume: a convex set of planes n.p <= d in aircraft coordinates
+// (x right, y up, z aft), built with the shots (see ShotTable). Cockpit poses are
+// softly held inside.
+struct CockpitVolume {
+    int planeCount;
+    float nx[COCKPIT_VOLUME_MAX_PLANES];
+    float ny[COCKPIT_VOLUME_MAX_PLANES];
+    float nz[COCKPIT_VOLUME_MAX_PLANES];
+    float d[COCKPIT_VOLUME_MAX_PLANES];
+};
+
+// Pilot head anchor
+// Cockpit shots can be anchored to the live pilots_head_* position instead of
+// the static acf_pe* eye point, so seat adjustments and head tracking offsets
+// carry into the shots. The position is low-pass filtered so head tracker
+// jitter does not shake the camera.
+struct HeadAnchorState {
+    float x, y, z;          // Filtered anchor (aircraft coordinates)
+    bool valid;             // Filter has been seeded
+};
+static bool g_anchorToPilotHead = false;
+static HeadAnchorState g_headAnchor = {0.0f, 0.0f, 0.0f, false};
+
+// Data derived from the user aircraft, built by a worker thread into one arena
+// The worker fills g_aircraftData, then publishes it through g_aircraftPublished;
+// the sim thread only reads it once published, and resets it in one step (after
+// joining the worker) when the next aircraft loads.
+struct AircraftData {
+    Arena arena;
+    CockpitPois* pois = nullptr;             // Cockpit points of interest, null if extraction failed
+    const char* poiMessage = "";             // Extraction status
+};
+static AircraftData g_aircraftData;
+static std::atomic<const AircraftData*> g_aircraftPublished{nullptr};
+static std::thread g_poiWorker;
+static std::atomic<bool> g_poiCancel{false};
+static bool g_poiApplied = false;            // Shots have been regenerated with the current POIs
+
+// Traffic spectator mode
+// The camera frames a traffic target instead of the user aircraft. The target is
+// tracked by mode-S ID because TCAS slots are reassigned as traffic comes and goes.
+struct SpectatorState {
+    int targetModeS;        // Spectated airframe (0 = pick the nearest)
+    int slot;               // TCAS slot of the target this frame (-1 = frame the user aircraft)
+    bool cutPending;        // Subject changed - cut straight to a fresh shot
+    float terrainY;         // Terrain height under the target (local Y, meters)
+    float identityTimer;    // Countdown to the next flight ID/type read
+};
+
+// Pose of whatever the camera is framing (user aircraft or spectated target)
+struct SubjectPose {
+    float x, y, z;
+    float heading, pitch, roll;
+};
+
+static bool g_enableSpectator = false;
+static bool g_trafficAvailable = false;
+static TrafficSnapshot g_traffic;
+static TrafficGrid g_trafficGrid;
+static SpectatorState g_spectator = {0, -1, false, 0.0f, 0.0f};
+static XPLMProbeRef g_terrainProbe = nullptr;
+
+// Target director
+// Every traffic airframe gets an interest score that is refreshed a few targets
+// per frame. Entries live in an indexed heap keyed by -score, so the most
+// interesting target is always at the top and a rescore is O(log n).
+struct TargetInterest {
+    int modeS;              // Airframe (0 = free entry)
+    FlightPhase phase;      // Confirmed phase, classified from the target's own motion
+    FlightPhase candidate;  // Phase the latest samples point to
+    int candidateSamples;   // Consecutive samples agreeing with candidate
+    float levelSeconds;     // Time vertical speed has stayed within PHASE_LEVEL_FPM
+    float lastClassified;   // Director clock of the last phase sample (<0 = never, seed on the next)
+    float terrainY;         // Terrain height under the target at the last probe (local Y, meters)
+    float terrainProbed;    // Director clock of the last terrain probe (<0 = never)
+    float score;
+    float lastSeen;         // Director clock when the target was last in the TCAS list
+    float lastShown;        // Director clock when the target was last the subject (<0 = never)
+    bool heavy;
+    DimsSource dimsSource;
+    AircraftDimensions dims;    // Cached per airframe - reused whenever it becomes the subject again
+};
+
+struct InterestHeap {
+    int size;
+    int entries[TRAFFIC_MAX_TARGETS];       // Heap of interest entry indices
+    int position[TRAFFIC_MAX_TARGETS];      // Heap position of each entry (-1 = not in the heap)
+};
+
+struct DirectorState {
+    float clock;            // Seconds since plugin start (director time base)
+    float subjectTime;      // Seconds on the current subject
+    int cursor;             // Next TCAS slot to rescore
+    float scoreBudget;      // Fractional targets left to rescore this frame
+};
+
+// Dimension estimates per ICAO type prefix (first match wins)
+struct TypeClassDims {
+    const char* prefix;
+    float wingspan;
+    float fuselageLength;
+    float height;
+    bool heavy;
+};
+
+static const TypeClassDims g_typeClassDims[] = {
+    {"A38", 79.8f, 72.7f, 24.1f, true},
+    {"B74", 64.4f, 70.7f, 19.4f, true},
+    {"B77", 64.8f, 73.9f, 18.5f, true},
+    {"B78", 60.1f, 62.8f, 17.0f, true},
+    {"A35", 64.8f, 66.8f, 17.1f, true},
+    {"A34", 63.5f, 67.9f, 17.3f, true},
+    {"A33", 60.3f, 63.7f, 16.8f, true},
+    {"B76", 47.6f, 54.9f, 15.8f, true},
+    {"MD11", 51.7f, 61.6f, 17.6f, true},
+    {"A30", 44.8f, 54.1f, 16.5f, true},
+    {"B75", 38.1f, 47.3f, 13.6f, false},
+    {"B73", 35.9f, 39.5f, 12.5f, false},
+    {"A2", 35.8f, 44.5f, 11.8f, false},
+    {"A3", 35.8f, 37.6f, 11.8f, false},
+    {"E1", 28.7f, 36.2f, 10.6f, false},
+    {"E2", 33.7f, 41.5f, 11.0f, false},
+    {"E7", 26.0f, 31.7f, 9.9f, false},
+    {"CRJ", 24.9f, 32.5f, 7.6f, false},
+    {"AT", 27.1f, 27.2f, 7.7f, false},
+    {"DH8", 28.4f, 32.8f, 8.3f, false},
+    {"C1", 11.0f, 8.3f, 2.7f, false},
+    {"PA", 10.7f, 7.3f, 2.2f, false},
+    {"SR2", 11.7f, 8.0f, 2.7f, false},
+};
+
+static bool g_spectatorDirector = false;
+static TargetInterest g_interest[TRAFFIC_MAX_TARGETS];
+static InterestHeap g_interestHeap;
+static DirectorState g_director = {0.0f, 0.0f, 1, 0.0f};
+
 // Menu items
 static XPLMMenuID g_menuId = nullptr;
 static int g_menuItemAuto = -1;
@@ -235,6 +784,9 @@ static XPLMDataRef g_drElevation = nullptr;
 static XPLMDataRef g_drLocalX = nullptr;
 static XPLMDataRef g_drLocalY = nullptr;
 static XPLMDataRef g_drLocalZ = nullptr;
+static XPLMDataRef g_drLocalVx = nullptr;
+static XPLMDataRef g_drLocalVy = nullptr;
+static XPLMDataRef g_drLocalVz = nullptr;
 static XPLMDataRef g_drPitch = nullptr;
 static XPLMDataRef g_drRoll = nullptr;
 static XPLMDataRef g_drHeading = nullptr;
@@ -246,6 +798,9 @@ static XPLMDataRef g_drPilotY = nullptr;
 static XPLMDataRef g_drPilotZ = nullptr;
 static XPLMDataRef g_drViewType = nullptr;
 static XPLMDataRef g_drTerrainY = nullptr;         // Terrain Y coordinate at aircraft position (AGL reference)
+static XPLMDataRef g_drVerticalSpeed = nullptr;    // Vertical speed (fpm)
+static XPLMDataRef g_drSunPitch = nullptr;         // Sun pitch from flat (degrees)
+static XPLMDataRef g_drSunHeading = nullptr;       // Sun heading from true north (degrees)
 
 // Aircraft dimension datarefs (read from .acf file by X-Plane)
 static XPLMDataRef g_drAcfSizeX = nullptr;         // Aircraft shadow/view size X (width/wingspan)
@@ -285,9 +840,51 @@ static float g_lockedFov = DEFAULT_FOV_DEG;
 // Flight loop callback
 static XPLMFlightLoopID g_flightLoopId = nullptr;
 
-// Predefined camera shots
-static std::vector<CameraShot> g_cockpitShots;
-static std::vector<CameraShot> g_externalShots;
+/**
+ * Everything the shot table builder reads, copied on the sim thread
+ * The builder touches no globals, so any thread can build from a copy.
+ */
+struct ShotBuildInput {
+    AircraftDimensions dims;        // Camera subject
+    CockpitPois pois;               // Aim the cockpit shots at these (if aimAtPois)
+    bool aimAtPois = false;         // POIs of the user aircraft, and the user aircraft is the subject
+    unsigned generation = 0;        // g_shotTableGeneration when copied
+};
+
+/**
+ * One generation of the shot library
+ * Immutable once published. A new table is built off to the side from a
+ * ShotBuildInput, handed over through g_pendingShotTable, so no reader ever
+ * sees a half-built one, and adopted into g_shotTable on the sim thread. The
+ * sim thread builds and adopts in one go when the subject or settings change;
+ * the cockpit POI worker builds one with the new POIs and leaves it for the
+ * flight loop. A table built from an input older than the latest one is
+ * dropped instead of adopted. The current shot holds a reference to its own
+ * table, so g_currentShotIndex and the cockpit volume stay meaningful until
+ * the next cut.
+ *
+ * The shot lists and their columns live in the table's own arena, which is
+ * released in one step when the last reference to the table goes.
+ */
+using ShotList = std::vector<CameraShot, ArenaAllocator<CameraShot>>;
+struct ShotTable {
+    Arena arena;                                   // Declared first: outlives everything allocated from it
+    ShotList cockpit{ArenaAllocator<CameraShot>(&arena)};
+    ShotList external{ArenaAllocator<CameraShot>(&arena)};
+    ShotColumns cockpitColumns;                    // Column mirrors of the shot lists, same row order
+    ShotColumns externalColumns;
+    CockpitVolume cockpitVolume = {};              // Sized for the same subject as the cockpit shots
+    float scale = 1.0f;                            // Subject scale factor the shots were sized for
+    bool poisAimed = false;                        // Cockpit shots were aimed at the user aircraft's POIs
+    unsigned generation = 0;                       // ShotBuildInput::generation
+};
+static std::shared_ptr<const ShotTable> g_shotTable = std::make_shared<const ShotTable>();  // Latest (sim thread)
+static std::shared_ptr<const ShotTable> g_currentShotTable;   // Table g_currentShotIndex refers to
+static std::atomic<ShotTable*> g_pendingShotTable{nullptr};    // Published, not yet adopted; owned by whoever swaps it out
+static unsigned g_shotTableGeneration = 0;                     // Latest ShotBuildInput taken (sim thread)
+static std::vector<int> g_shotCandidates;                      // Selection scratch
+static std::vector<float> g_shotWeights;                       // Selection scratch, parallel to g_shotCandidates
+static ShotPositions g_shotPositions;                          // Selection scratch: opening position of every row
 
 /**
  * Settings Window using ImgWindow
@@ -306,6 +903,11 @@ static std::unique_ptr<SettingsWindow> g_settingsWindow;
 // Function declarations
 static void ReadAircraftDimensions();
 static void GenerateDynamicCameraShots();
+static ShotBuildInput SnapshotShotBuildInput();
+static ShotTable* BuildShotTable(const ShotBuildInput& input);
+static void BuildShotColumns(const ShotList& shots, ShotColumns& columns, Arena& arena);
+static void PublishShotTable(ShotTable* table);
+static void AdoptPendingShotTable();
 static void UpdateMenuState();
 static float FlightLoopCallback(float inElapsedSinceLastCall, float inElapsedTimeSinceLastFlightLoop, int inCounter, void* inRefcon);
 static int CameraControlCallback(XPLMCameraPosition_t* outCameraPosition, int inIsLosingControl, void* inRefcon);
@@ -316,17 +918,44 @@ static void PauseCameraControl();
 static void ResumeCameraControl();
 static bool CheckAutoConditions();
 static CameraShot SelectNextShot();
+static ShotEvaluator ChooseShotEvaluator(const CameraShot& shot);
+static void EvaluateCurrentShot(float elapsed, float acfX, float acfY, float acfZ,
+                                float acfHeading, float acfPitch, float acfRoll,
+                                XPLMCameraPosition_t* outCameraPosition);
+static bool IsShotBlockedByTraffic(const CameraShot& shot);
+static void ReadCompositionSubject(CompositionSubject& out);
+static void WeighCandidateCompositions(const ShotList& shots, const ShotColumns& columns,
+                                       const int* candidates, int count, float* outWeights);
+static int DrawWeightedCandidate(const float* weights, int count);
+static FlightPhase ClassifyFlightPhase(FlightPhase current, bool onGround, float groundSpeedKt,
+                                       float verticalSpeedFpm, float aglFt, float levelSeconds);
+static void SeedFlightPhase();
+static void ReadSubjectPose(SubjectPose& out);
+static void ReadSubjectVelocity(float& outVx, float& outVy, float& outVz);
+static bool PlanTwoShot();
+static bool PlanLandmarkShot();
+static void PlanWingman(const CameraShot& shot);
 static float Lerp(float a, float b, float t);
-static float EaseInOutCubic(float t);
 static float LinearDrift(float baseValue, float driftAmount, float normalizedTime);
 static void SaveSettings();
 static void LoadSettings();
+static bool SettingWidgetUi(const char* key);
+static void LoadProfiles();
+static void ApplyProfile(int index);
 static std::string GetPluginPath();
 static float FocalLengthToFov(float focalLengthMm);
 static float FovToFocalLength(float fovDeg);
 static void ApplyFovEffect(float targetFocalLength, float deltaTime);
 static void SaveCameraEffectState();
 static void RestoreCameraEffectState();
+static void ApplyCameraEffectSettings();
+static void StartBeatAnalysis();
+static void StopBeatAnalysis();
+static void StartCockpitPoiExtraction();
+static void StopCockpitPoiExtraction();
+static void ResetAircraftData();
+static const CockpitPois* PublishedPois();
+static void BeginResumeTransition();
 
 /**
  * SettingsWindow constructor
@@ -346,6 +975,27 @@ void SettingsWindow::buildInterface() {
     ImGui::Separator();
     ImGui::Spacing();
     
+    ImGui::SetNextItemWidth(180);
+    const char* profilePreview = (g_activeProfile >= 0) ? g_profiles[g_activeProfile].name.c_str() : "Custom";
+    if (ImGui::BeginCombo("Profile##profile", profilePreview)) {
+        for (int i = 0; i < static_cast<int>(g_profiles.size()); i++) {
+            if (ImGui::Selectable(g_profiles[i].name.c_str(), i == g_activeProfile)) {
+                ApplyProfile(i);
+            }
+        }
+        ImGui::EndCombo();
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton("Reload##profiles")) {
+        LoadProfiles();
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Named setting sets from profiles.cfg in the plugin folder.\nA profile only changes the settings it lists.\nCommands: MovieCamera/profile/next, /previous and /1 to /9.");
+    }
+    ImGui::Spacing();
+    
     ImGui::Text("Debug Tools");
     ImGui::SameLine();
     ImGui::TextDisabled("(?)");
@@ -353,43 +1003,28 @@ void SettingsWindow::buildInterface() {
         ImGui::SetTooltip("Select data source used to determine aircraft dimensions.\nAuto uses available datarefs with fallbacks.\nManual forces the value you enter.");
     }
     ImGui::SetNextItemWidth(180);
-    int wsrc = static_cast<int>(g_wingspanSource);
-    const char* wsrcItems[] = {"Auto", "acf_size_x", "wing semilen", "Default", "Manual"};
-    if (ImGui::Combo("Wingspan Source##wsrc", &wsrc, wsrcItems, 5)) {
-        g_wingspanSource = static_cast<WingspanSource>(wsrc);
+    if (SettingWidgetUi("wingspan_source")) {
         ReadAircraftDimensions();
         GenerateDynamicCameraShots();
     }
     ImGui::SetNextItemWidth(120);
-    if (ImGui::InputFloat("Wingspan (m)##wmanual", &g_manualWingspan, 0.5f, 1.0f, "%.1f")) {
-        g_manualWingspan = std::clamp(g_manualWingspan, MIN_WINGSPAN, MAX_WINGSPAN);
-    }
+    SettingWidgetUi("manual_wingspan");
     
     ImGui::SetNextItemWidth(180);
-    int fsrc = static_cast<int>(g_fuselageSource);
-    const char* fsrcItems[] = {"Auto", "acf_size_z", "cg range", "pilot eye Z", "Default", "Manual"};
-    if (ImGui::Combo("Fuselage Source##fsrc", &fsrc, fsrcItems, 6)) {
-        g_fuselageSource = static_cast<FuselageLengthSource>(fsrc);
+    if (SettingWidgetUi("fuselage_source")) {
         ReadAircraftDimensions();
         GenerateDynamicCameraShots();
     }
     ImGui::SetNextItemWidth(120);
-    if (ImGui::InputFloat("Fuselage (m)##fmanual", &g_manualFuselageLength, 0.5f, 1.0f, "%.1f")) {
-        g_manualFuselageLength = std::clamp(g_manualFuselageLength, MIN_FUSELAGE_LENGTH, MAX_FUSELAGE_LENGTH);
-    }
+    SettingWidgetUi("manual_fuselage_length");
     
     ImGui::SetNextItemWidth(180);
-    int hsrc = static_cast<int>(g_heightSource);
-    const char* hsrcItems[] = {"Auto", "gear + pilot", "pilot eye", "Default", "Manual"};
-    if (ImGui::Combo("Height Source##hsrc", &hsrc, hsrcItems, 5)) {
-        g_heightSource = static_cast<HeightSource>(hsrc);
+    if (SettingWidgetUi("height_source")) {
         ReadAircraftDimensions();
         GenerateDynamicCameraShots();
     }
     ImGui::SetNextItemWidth(120);
-    if (ImGui::InputFloat("Height (m)##hman", &g_manualHeight, 0.2f, 0.5f, "%.1f")) {
-        g_manualHeight = std::clamp(g_manualHeight, MIN_HEIGHT, MAX_HEIGHT);
-    }
+    SettingWidgetUi("manual_height");
     
     if (ImGui::SmallButton("Apply Manual Values")) {
         g_wingspanSource = WingspanSource::Manual;
@@ -404,14 +1039,50 @@ void SettingsWindow::buildInterface() {
         GenerateDynamicCameraShots();
     }
     ImGui::Text("Wingspan: %.1f m | Fuselage: %.1f m | Height: %.1f m", g_aircraftDims.wingspan, g_aircraftDims.fuselageLength, g_aircraftDims.height);
+    // The aircraft data is only read once the worker has published it
+    if (const AircraftData* data = g_aircraftPublished.load(std::memory_order_acquire)) {
+        ArenaStats arena = GetArenaStats(data->arena);
+        ImGui::Text("Aircraft data: cockpit POIs %s (%s), %.1f KB in %d chunks",
+                    data->pois ? "ready" : "unavailable", data->poiMessage, arena.usedBytes / 1024.0, arena.chunks);
+    } else {
+        ImGui::TextDisabled("Aircraft data: building...");
+    }
+    ArenaStats shotArena = GetArenaStats(g_shotTable->arena);
+    ImGui::Text("Shot table: %.1f KB in %d chunks%s | Arena pool: %.0f KB spare",
+                shotArena.usedBytes / 1024.0, shotArena.chunks,
+                (g_currentShotTable && g_currentShotTable != g_shotTable) ? " (+ the current shot's)" : "",
+                GetArenaPoolBytes() / 1024.0);
+    FlightPathSample ahead;
+    if (PredictFlightPath(30.0f, ahead) && g_drLocalX && g_drLocalY && g_drLocalZ) {
+        static const char* const GUIDANCE_NAMES[] = {"none", "extrapolated", "heading bug", "FMS route"};
+        float dx = ahead.x - XPLMGetDataf(g_drLocalX);
+        float dy = ahead.y - XPLMGetDataf(g_drLocalY);
+        float dz = ahead.z - XPLMGetDataf(g_drLocalZ);
+        ImGui::Text("Predicted in 30 s: %.0f m ahead, %+.0f m vertical, +/- %.0f m (%s)",
+                    std::sqrt(dx * dx + dz * dz), dy, ahead.uncertainty,
+                    GUIDANCE_NAMES[static_cast<int>(GetFlightPathGuidance())]);
+    } else {
+        ImGui::TextDisabled("Predicted in 30 s: no prediction yet");
+    }
+    if (g_functionActive && g_currentShot.type == CameraType::External) {
+        const CompositionScore& score = g_composition.score;
+        ImGui::Text("Composition: %.2f (frame %.0f%%, thirds %.2f, lead %.2f, in frame %.0f%%), %s lens",
+                    score.total, score.framed * 100.0f, score.thirds, score.headroom, score.clipping * 100.0f,
+                    IsCompositionLensLive() ? "live" : "estimated");
+    } else {
+        ImGui::TextDisabled("Composition: exterior shots only");
+    }
+    if (g_landmarkShot.match.landmark >= 0) {
+        const LandmarkMatch& match = g_landmarkShot.match;
+        ImGui::Text("Landmark ahead: %s, %.1f km from the path in %.0f s",
+                    GetLandmark(match.landmark).name.c_str(), match.distance / 1000.0f, match.point * LANDMARK_SEARCH_STEP);
+    } else {
+        ImGui::TextDisabled("Landmark ahead: none (%s)", g_landmarkMessage.c_str());
+    }
     
     ImGui::Spacing();
     ImGui::SetNextItemWidth(180);
-    int shotType = static_cast<int>(g_debugShotType);
-    const char* shotTypeItems[] = {"Auto", "Cockpit", "External"};
-    if (ImGui::Combo("Next Shot Type##shottype", &shotType, shotTypeItems, 3)) {
-        g_debugShotType = static_cast<DebugShotType>(shotType);
-    }
+    SettingWidgetUi("debug_shot_type");
     ImGui::SetNextItemWidth(120);
     int shotTypeRaw = static_cast<int>(g_debugShotType);
     if (ImGui::InputInt("Next Shot Type (0-2)##shottypeint", &shotTypeRaw)) {
@@ -419,9 +1090,7 @@ void SettingsWindow::buildInterface() {
         g_debugShotType = static_cast<DebugShotType>(shotTypeRaw);
     }
     ImGui::SetNextItemWidth(120);
-    if (ImGui::InputInt("Next Shot Index##shotidx", &g_debugShotIndex)) {
-        if (g_debugShotIndex < -1) g_debugShotIndex = -1;
-    }
+    SettingWidgetUi("debug_shot_index");
     ImGui::SameLine();
     if (ImGui::SmallButton("Force Next Shot")) {
         g_currentShotTime = 0.0f;
@@ -434,10 +1103,7 @@ void SettingsWindow::buildInterface() {
     ImGui::Text("Delay (seconds):");
     ImGui::SameLine();
     ImGui::SetNextItemWidth(100);
-    if (ImGui::InputFloat("##delay", &g_delaySeconds, 1.0f, 10.0f, "%.0f")) {
-        if (g_delaySeconds < 1.0f) g_delaySeconds = 1.0f;
-        if (g_delaySeconds > 300.0f) g_delaySeconds = 300.0f;
-    }
+    SettingWidgetUi("delay_seconds");
     ImGui::SameLine();
     ImGui::TextDisabled("(?)");
     if (ImGui::IsItemHovered()) {
@@ -450,10 +1116,7 @@ void SettingsWindow::buildInterface() {
     ImGui::Text("Auto Alt (ft):");
     ImGui::SameLine();
     ImGui::SetNextItemWidth(100);
-    if (ImGui::InputFloat("##autoalt", &g_autoAltFt, 100.0f, 1000.0f, "%.0f")) {
-        if (g_autoAltFt < 0.0f) g_autoAltFt = 0.0f;
-        if (g_autoAltFt > 50000.0f) g_autoAltFt = 50000.0f;
-    }
+    SettingWidgetUi("auto_alt_ft");
     ImGui::SameLine();
     ImGui::TextDisabled("(?)");
     if (ImGui::IsItemHovered()) {
@@ -467,18 +1130,140 @@ void SettingsWindow::buildInterface() {
     ImGui::Text("Min (s):");
     ImGui::SameLine();
     ImGui::SetNextItemWidth(80);
-    if (ImGui::InputFloat("##shotmin", &g_shotMinDuration, 0.5f, 1.0f, "%.1f")) {
-        if (g_shotMinDuration < 1.0f) g_shotMinDuration = 1.0f;
-        if (g_shotMinDuration > g_shotMaxDuration) g_shotMinDuration = g_shotMaxDuration;
-    }
+    SettingWidgetUi("shot_min_duration");
     
     ImGui::SameLine();
     ImGui::Text("Max (s):");
     ImGui::SameLine();
     ImGui::SetNextItemWidth(80);
-    if (ImGui::InputFloat("##shotmax", &g_shotMaxDuration, 0.5f, 1.0f, "%.1f")) {
-        if (g_shotMaxDuration < g_shotMinDuration) g_shotMaxDuration = g_shotMinDuration;
-        if (g_shotMaxDuration > 30.0f) g_shotMaxDuration = 30.0f;
+    SettingWidgetUi("shot_max_duration");
+    
+    // Transition style between shots
+    ImGui::SetNextItemWidth(180);
+    SettingWidgetUi("transition_style");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("How the camera moves between shots.\nAuto whip-pans between cockpit and exterior,\npushes in/pulls out on large distance changes and match-cuts otherwise.");
+    }
+    ImGui::SetNextItemWidth(150);
+    SettingWidgetUi("transition_duration");
+    SettingWidgetUi("instrument_cues");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Cut to the cockpit control that just changed:\nautopilot modes and selectors, radios, gear/flaps/speedbrake, MCDU page.");
+    }
+    SettingWidgetUi("landmark_shots");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("When the flight path passes a peak, city, bridge or coastline\nfrom landmarks.csv, frame the aircraft against it.\n%s", g_landmarkMessage.c_str());
+    }
+    SettingWidgetUi("head_anchor");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Place cockpit shots around your own head position\n(seat adjustments, TrackIR and similar head tracking)\ninstead of the aircraft's default eye point.");
+    }
+    
+    ImGui::Spacing();
+    ImGui::Separator();
+    SettingWidgetUi("enable_beat_sync");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Bias shot durations so cuts land on the beats of a local WAV file.\nThe file is analysed once and cached next to it (.beats).");
+    }
+    if (g_enableBeatSync) {
+        ImGui::Indent();
+        ImGui::SetNextItemWidth(300);
+        SettingWidgetUi("beat_audio_path");
+        
+        BeatAnalysisState beatState = g_beatState.load(std::memory_order_acquire);
+        if (beatState == BeatAnalysisState::Running) {
+            ImGui::TextDisabled("Analysing...");
+        } else {
+            if (ImGui::SmallButton("Analyse")) {
+                StartBeatAnalysis();
+            }
+            ImGui::SameLine();
+            if (beatState == BeatAnalysisState::Ready) {
+                ImGui::Text("%.1f BPM, %zu beats (%s)", g_beatTimeline.bpm, g_beatTimeline.beats.size(), g_beatMessage.c_str());
+            } else if (beatState == BeatAnalysisState::Failed) {
+                ImGui::Text("Failed: %s", g_beatMessage.c_str());
+            } else {
+                ImGui::TextDisabled("Not analysed");
+            }
+        }
+        
+        ImGui::SetNextItemWidth(120);
+        SettingWidgetUi("beat_offset");
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Position in the track when camera control (recording) starts");
+        }
+        ImGui::Text("Track time: %.1f s", g_musicClock + g_beatOffset);
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Restart Clock")) {
+            g_musicClock = 0.0f;
+        }
+        ImGui::Unindent();
+    }
+    
+    ImGui::Spacing();
+    ImGui::Separator();
+    SettingWidgetUi("enable_spectator");
+    ImGui::SameLine();
+    ImGui::TextDisabled("(?)");
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Frame AI or multiplayer traffic instead of your own aircraft.\nWithout a chosen target the nearest traffic is used. Exterior shots only.");
+    }
+    if (g_enableSpectator) {
+        ImGui::Indent();
+        if (!g_trafficAvailable) {
+            ImGui::TextDisabled("TCAS traffic is not available in this X-Plane version");
+        } else {
+            int slot = g_spectator.slot;
+            char preview[64];
+            if (slot > 0) {
+                snprintf(preview, sizeof(preview), "%s %s (%.1f km)", g_traffic.flightId[slot], g_traffic.icaoType[slot], g_traffic.distance[slot] / 1000.0f);
+            } else {
+                snprintf(preview, sizeof(preview), "No traffic in range");
+            }
+            ImGui::SetNextItemWidth(250);
+            if (ImGui::BeginCombo("Target##spectator", preview)) {
+                for (int i = 1; i < g_traffic.count; i++) {
+                    if (g_traffic.modeS[i] == 0) continue;
+                    char label[64];
+                    snprintf(label, sizeof(label), "%s %s (%.1f km)##%d", g_traffic.flightId[i], g_traffic.icaoType[i], g_traffic.distance[i] / 1000.0f, i);
+                    if (ImGui::Selectable(label, i == slot)) {
+                        // Choosing by hand takes over from the director
+                        g_spectator.targetModeS = g_traffic.modeS[i];
+                        g_spectatorDirector = false;
+                    }
+                }
+                ImGui::EndCombo();
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Nearest")) {
+                g_spectator.targetModeS = 0;
+                g_spectatorDirector = false;
+            }
+            SettingWidgetUi("spectator_director");
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Move on to the most interesting traffic at shot boundaries:\ntakeoffs and landings, runway activity, aircraft closing on you,\nheavies, and anything not shown for a while.");
+            }
+            if (g_spectatorDirector && g_interestHeap.size > 0) {
+                const TargetInterest& top = g_interest[g_interestHeap.entries[0]];
+                int topSlot = FindTrafficSlot(g_traffic, top.modeS);
+                ImGui::SameLine();
+                ImGui::TextDisabled("next: %s %s (%.1f, %s)", topSlot > 0 ? g_traffic.flightId[topSlot] : "?",
+                                    topSlot > 0 ? g_traffic.icaoType[topSlot] : "", top.score,
+                                    g_phasePolicies[static_cast<int>(top.phase)].name);
+            }
+            ImGui::TextDisabled("%d aircraft in TCAS range", std::max(g_traffic.count - 1, 0));
+        }
+        ImGui::Unindent();
     }
     
     ImGui::Spacing();
@@ -497,6 +1282,17 @@ void SettingsWindow::buildInterface() {
     
     ImGui::Text("Mouse Idle: %.1f s", g_mouseIdleTime);
     
+    const PhasePolicy& phasePolicy = g_phasePolicies[static_cast<int>(g_flightPhase.phase)];
+    ImGui::Text("Flight Phase: %s", phasePolicy.name);
+    if (g_flightPhase.candidate != g_flightPhase.phase) {
+        ImGui::SameLine();
+        ImGui::TextDisabled("(-> %s %d/%d)", g_phasePolicies[static_cast<int>(g_flightPhase.candidate)].name,
+                            g_flightPhase.candidateSamples, PHASE_CONFIRM_SAMPLES);
+    }
+    ImGui::TextDisabled("%s | GS %.0f kt | VS %.0f fpm | AGL %.0f ft | pace x%.1f",
+                        g_flightPhase.onGround ? "ground" : "air", g_flightPhase.groundSpeedKt,
+                        g_flightPhase.verticalSpeedFpm, g_flightPhase.aglFt, phasePolicy.durationScale);
+    
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
@@ -510,7 +1306,7 @@ void SettingsWindow::buildInterface() {
     }
     
     // FOV/Focal Length Effect
-    ImGui::Checkbox("Enable FOV Effect", &g_enableFovEffect);
+    SettingWidgetUi("enable_fov_effect");
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Enable focal length simulation via FOV control");
     }
@@ -524,11 +1320,7 @@ void SettingsWindow::buildInterface() {
         
         // FOV slider
         ImGui::SetNextItemWidth(200);
-        if (ImGui::SliderFloat("Base FOV##fov", &g_baseFov, MIN_FOV_DEG, MAX_FOV_DEG, "%.1f°")) {
-            // Keep within valid range
-            if (g_baseFov < MIN_FOV_DEG) g_baseFov = MIN_FOV_DEG;
-            if (g_baseFov > MAX_FOV_DEG) g_baseFov = MAX_FOV_DEG;
-        }
+        SettingWidgetUi("base_fov");
         
         // Focal length presets
         ImGui::Text("Presets:");
@@ -545,7 +1337,7 @@ void SettingsWindow::buildInterface() {
         
         // Transition speed
         ImGui::SetNextItemWidth(150);
-        ImGui::SliderFloat("Transition Speed##fovspeed", &g_fovTransitionSpeed, 1.0f, 30.0f, "%.1f");
+        SettingWidgetUi("fov_transition_speed");
         if (ImGui::IsItemHovered()) {
             ImGui::SetTooltip("Speed of FOV transitions between shots (degrees per second)");
         }
@@ -554,7 +1346,7 @@ void SettingsWindow::buildInterface() {
     }
     
     // Handheld Camera Effect
-    ImGui::Checkbox("Enable Handheld Effect", &g_enableHandheldEffect);
+    SettingWidgetUi("enable_handheld_effect");
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Enable handheld camera shake effect for external views");
     }
@@ -562,7 +1354,7 @@ void SettingsWindow::buildInterface() {
     if (g_enableHandheldEffect) {
         ImGui::Indent();
         ImGui::SetNextItemWidth(150);
-        ImGui::SliderFloat("Shake Intensity##shake", &g_handheldIntensity, 0.0f, 1.0f, "%.2f");
+        SettingWidgetUi("handheld_intensity");
         if (ImGui::IsItemHovered()) {
             ImGui::SetTooltip("Amount of camera shake (0 = none, 1 = maximum)");
         }
@@ -570,7 +1362,7 @@ void SettingsWindow::buildInterface() {
     }
     
     // G-Force Camera Effect (Internal views)
-    ImGui::Checkbox("Enable G-Force Effect", &g_enableGForceEffect);
+    SettingWidgetUi("enable_gforce_effect");
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip("Enable G-force camera movement for internal views");
     }
@@ -739,6 +1531,8 @@ static void ReadAircraftDimensions() {
     if (g_aircraftDims.height < MIN_HEIGHT) g_aircraftDims.height = STANDARD_HEIGHT;
     if (g_aircraftDims.height > MAX_HEIGHT) g_aircraftDims.height = MAX_HEIGHT;
     
+    g_userAircraftDims = g_aircraftDims;
+    
     char msg[256];
     snprintf(msg, sizeof(msg), "MovieCamera: Final aircraft dims - Wingspan: %.1fm, Length: %.1fm, Height: %.1fm, PilotEye: (%.1f, %.1f, %.1f)\n",
              g_aircraftDims.wingspan, g_aircraftDims.fuselageLength, g_aircraftDims.height,
@@ -750,10 +1544,10 @@ static void ReadAircraftDimensions() {
  * Calculate the minimum camera distance required to keep the aircraft visible
  * This ensures the camera is far enough to frame the aircraft properly
  */
-static float CalculateMinVisibleDistance() {
+static float CalculateMinVisibleDistance(const AircraftDimensions& dims) {
     // The larger the aircraft, the farther the camera needs to be
     // Use the maximum dimension (wingspan or fuselage) as reference
-    float maxDimension = std::max(g_aircraftDims.wingspan, g_aircraftDims.fuselageLength);
+    float maxDimension = std::max(dims.wingspan, dims.fuselageLength);
     // Camera should be at least 1.5x the max dimension away to ensure full visibility
     return std::max(maxDimension * 1.5f, MIN_CAMERA_DISTANCE_FROM_AIRCRAFT);
 }
@@ -764,9 +1558,9 @@ static float CalculateMinVisibleDistance() {
  * Smaller aircraft need higher zoom (closer view) to be visible
  * Farther cameras may need more zoom to keep aircraft visible
  */
-static float CalculateIntelligentZoom(float baseZoom, float cameraDistance) {
+static float CalculateIntelligentZoom(const AircraftDimensions& dims, float baseZoom, float cameraDistance) {
     // Get the scaling factor for the aircraft
-    float scale = g_aircraftDims.getScaleFactor();
+    float scale = dims.getScaleFactor();
     
     // For larger aircraft (scale > 1), reduce zoom to fit in frame
     // For smaller aircraft (scale < 1), increase zoom to make aircraft more visible
@@ -774,7 +1568,7 @@ static float CalculateIntelligentZoom(float baseZoom, float cameraDistance) {
     
     // Adjust zoom based on camera distance - farther cameras need more zoom
     // Use wingspan as reference distance
-    float distanceFactor = cameraDistance / (g_aircraftDims.wingspan * 2.0f);
+    float distanceFactor = cameraDistance / (dims.wingspan * 2.0f);
     distanceFactor = std::clamp(distanceFactor, 0.7f, 1.5f);
     
     // Combine adjustments - farther distance increases zoom slightly
@@ -785,87 +1579,410 @@ static float CalculateIntelligentZoom(float baseZoom, float cameraDistance) {
 }
 
 /**
- * Generate dynamic camera shots based on aircraft dimensions
- * This calculates camera positions relative to the aircraft's actual size
- * 
- * Camera positioning principles:
- * 1. External shots are positioned based on aircraft size (wingspan, fuselage length, height)
- * 2. Camera should never clip into the aircraft model
- * 3. Each shot provides a visually distinct perspective
- * 4. Zoom levels are calculated to keep aircraft well-framed
- * 5. Drift amounts create smooth, cinematic camera movement
+ * Bit for a flight phase in CameraShot::phaseMask
  */
-static void GenerateDynamicCameraShots() {
-    // Get scale factor based on aircraft size
-    float scale = g_aircraftDims.getScaleFactor();
-    float wingspan = g_aircraftDims.wingspan;
-    float fuselageLen = g_aircraftDims.fuselageLength;
-    float height = g_aircraftDims.height;
-    
-    // Clear existing shots
-    g_cockpitShots.clear();
-    g_externalShots.clear();
+constexpr unsigned PhaseBit(FlightPhase phase) {
+    return 1u << static_cast<int>(phase);
+}
+
+constexpr unsigned PHASES_ALL = ~0u;
+constexpr unsigned PHASES_GROUND = PhaseBit(FlightPhase::Parked) | PhaseBit(FlightPhase::Taxi) |
+                                   PhaseBit(FlightPhase::TakeoffRoll) | PhaseBit(FlightPhase::LandingRoll);
+constexpr unsigned PHASES_AIR = PhaseBit(FlightPhase::InitialClimb) | PhaseBit(FlightPhase::Cruise) |
+                                PhaseBit(FlightPhase::Descent) | PhaseBit(FlightPhase::Approach);
+constexpr unsigned PHASES_ROLLING = PhaseBit(FlightPhase::TakeoffRoll) | PhaseBit(FlightPhase::LandingRoll);
+constexpr unsigned PHASES_ENROUTE = PhaseBit(FlightPhase::Cruise) | PhaseBit(FlightPhase::Descent);
+
+/**
+ * Shot families: which flight phases each generated shot is used in
+ * Shots not listed here are used in every phase
+ */
+struct ShotFamilyEntry {
+    const char* name;
+    unsigned phaseMask;
+};
+
+static const ShotFamilyEntry g_shotFamilies[] = {
+    // Cockpit
+    {"Left Panel",     PHASES_ROLLING | PhaseBit(FlightPhase::Taxi) | PhaseBit(FlightPhase::InitialClimb) | PhaseBit(FlightPhase::Approach)},
+    {"Right Panel",    PhaseBit(FlightPhase::Parked) | PHASES_ENROUTE},
+    {"Overhead Panel", PhaseBit(FlightPhase::Parked) | PhaseBit(FlightPhase::Cruise)},
+    {"PFD View",       PHASES_AIR | PhaseBit(FlightPhase::TakeoffRoll)},
+    {"ND View",        PHASES_AIR},
+    {"Pilot View",     PHASES_ALL & ~PhaseBit(FlightPhase::Parked)},
+    {"Left Window",    PHASES_AIR | PhaseBit(FlightPhase::Taxi)},
+    {"Right Window",   PHASES_AIR | PhaseBit(FlightPhase::Taxi)},
+    {"Pedestal View",  PhaseBit(FlightPhase::Parked) | PHASES_ENROUTE},
+    // External
+    {"Rear Chase",     PHASES_ALL & ~PhaseBit(FlightPhase::Parked)},
+    {"High Wide",      PHASES_AIR},
+    {"Left Flyby",     PHASES_ROLLING | PhaseBit(FlightPhase::InitialClimb) | PhaseBit(FlightPhase::Cruise) | PhaseBit(FlightPhase::Approach)},
+    {"Right Flyby",    PHASES_ROLLING | PhaseBit(FlightPhase::InitialClimb) | PhaseBit(FlightPhase::Cruise) | PhaseBit(FlightPhase::Approach)},
+    {"Engine L",       PhaseBit(FlightPhase::Parked) | PhaseBit(FlightPhase::Taxi) | PhaseBit(FlightPhase::TakeoffRoll) | PhaseBit(FlightPhase::Cruise)},
+    {"Engine R",       PhaseBit(FlightPhase::Parked) | PhaseBit(FlightPhase::Taxi) | PhaseBit(FlightPhase::TakeoffRoll) | PhaseBit(FlightPhase::Cruise)},
+    {"Low Front",      PHASES_GROUND | PhaseBit(FlightPhase::Approach)},
+    {"Belly View",     PHASES_AIR},
+    {"Nose Close",     PhaseBit(FlightPhase::Parked) | PhaseBit(FlightPhase::Taxi) | PhaseBit(FlightPhase::Cruise)},
+    {"High Orbit",     PhaseBit(FlightPhase::Parked) | PHASES_ENROUTE},
+    {"Low Orbit",      PhaseBit(FlightPhase::Parked) | PHASES_ENROUTE},
+    {"Nose Orbit",     PhaseBit(FlightPhase::Parked) | PhaseBit(FlightPhase::Cruise)},
+    {"Wingman Left",   PHASES_AIR},
+    {"Wingman Echelon", PHASES_AIR},
+    {"Photo Ship",     PHASES_ENROUTE | PhaseBit(FlightPhase::InitialClimb)},
+};
+
+/**
+ * Apply the shot family table to a generated shot list
+ */
+static void AssignShotFamilies(ShotList& shots) {
+    for (CameraShot& shot : shots) {
+        for (const ShotFamilyEntry& entry : g_shotFamilies) {
+            if (shot.name == entry.name) {
+                shot.phaseMask = entry.phaseMask;
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Build an orbit shot around a look-at target given in aircraft coordinates
+ * The base position fields hold the orbit start point so that code reading
+ * x/y/z (e.g. cut target computation) still gets a sensible position
+ */
+static CameraShot MakeOrbitShot(const char* name, float radius, float elevationDeg, float rateDegPerSec,
+                                float startAzimuthDeg, float targetX, float targetY, float targetZ,
+                                float zoom, float duration) {
+    float el = elevationDeg * PI / 180.0f;
+    float az = startAzimuthDeg * PI / 180.0f;
+    float horizontal = radius * std::cos(el);
+    
+    CameraShot shot = {CameraType::External,
+                       targetX + horizontal * std::sin(az), targetY + radius * std::sin(el), targetZ - horizontal * std::cos(az),
+                       -elevationDeg, startAzimuthDeg + 180.0f, 0.0f, zoom, duration, name,
+                       0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    shot.motion = ShotMotion::Orbit;
+    shot.orbitRadius = radius;
+    shot.orbitElevation = elevationDeg;
+    shot.orbitRate = rateDegPerSec;
+    shot.orbitStartAzimuth = startAzimuthDeg;
+    shot.orbitTargetX = targetX;
+    shot.orbitTargetY = targetY;
+    shot.orbitTargetZ = targetZ;
+    return shot;
+}
+
+/**
+ * Cockpit shots that are aimed at a point of interest once the cockpit
+ * object has been parsed; the fallback is used if the primary was not found
+ */
+struct CockpitPoiAim {
+    const char* name;
+    CockpitPoiKind primary;
+    CockpitPoiKind fallback;
+};
+
+static const CockpitPoiAim g_cockpitPoiAims[] = {
+    {"Center Panel",   CockpitPoiKind::PanelCenter, CockpitPoiKind::Autopilot},
+    {"Left Panel",     CockpitPoiKind::PanelLeft,   CockpitPoiKind::Throttles},
+    {"Right Panel",    CockpitPoiKind::PanelRight,  CockpitPoiKind::Radios},
+    {"Overhead Panel", CockpitPoiKind::Overhead,    CockpitPoiKind::Overhead},
+    {"PFD View",       CockpitPoiKind::PanelLeft,   CockpitPoiKind::PanelCenter},
+    {"ND View",        CockpitPoiKind::PanelCenter, CockpitPoiKind::PanelLeft},
+    {"Pedestal View",  CockpitPoiKind::Fms,         CockpitPoiKind::Pedestal},
+};
+
+/**
+ * Cockpit shot that frames each instrument group, and the POI to aim it at
+ */
+struct InstrumentShot {
+    InstrumentGroup group;
+    const char* shotName;
+    CockpitPoiKind poi;
+};
+
+static const InstrumentShot g_instrumentShots[] = {
+    {InstrumentGroup::Autopilot, "Center Panel",  CockpitPoiKind::Autopilot},
+    {InstrumentGroup::Radios,    "Right Panel",   CockpitPoiKind::Radios},
+    {InstrumentGroup::GearFlaps, "Pedestal View", CockpitPoiKind::GearFlaps},
+    {InstrumentGroup::Mcdu,      "Pedestal View", CockpitPoiKind::Fms},
+};
+
+/**
+ * Aim one cockpit shot at a point of interest, if it was found
+ * The camera position is kept; only the base pitch and heading change.
+ */
+static bool AimShotAtPoi(CameraShot& shot, CockpitPoiKind poi, const CockpitPois& pois, const AircraftDimensions& dims) {
+    int kind = static_cast<int>(poi);
+    if (!pois.found[kind]) return false;
+    
+    // POIs share the pilot eye's origin; shot positions are relative to the eye
+    float dx = pois.x[kind] - (dims.pilotEyeX + shot.x);
+    float dy = pois.y[kind] - (dims.pilotEyeY + shot.y);
+    float dz = pois.z[kind] - (dims.pilotEyeZ + shot.z);
+    float horizontal = std::sqrt(dx * dx + dz * dz);
+    if (horizontal + std::abs(dy) < COCKPIT_POI_MIN_DISTANCE) return false;
+    shot.heading = std::atan2(dx, -dz) * 180.0f / PI;
+    shot.pitch = std::atan2(dy, horizontal) * 180.0f / PI;
+    return true;
+}
+
+/**
+ * Aim the cockpit shots at the user aircraft's points of interest
+ */
+static void AimCockpitShotsAtPois(ShotList& shots, const CockpitPois& pois, const AircraftDimensions& dims) {
+    for (CameraShot& shot : shots) {
+        for (const CockpitPoiAim& aim : g_cockpitPoiAims) {
+            if (shot.name != aim.name) continue;
+            if (!AimShotAtPoi(shot, aim.primary, pois, dims)) {
+                AimShotAtPoi(shot, aim.fallback, pois, dims);
+            }
+            break;
+        }
+    }
+}
+
+static void AddCockpitPlane(CockpitVolume& v, float nx, float ny, float nz, float px, float py, float pz) {
+    if (v.planeCount >= COCKPIT_VOLUME_MAX_PLANES) return;
+    float len = std::sqrt(nx * nx + ny * ny + nz * nz);
+    v.nx[v.planeCount] = nx / len;
+    v.ny[v.planeCount] = ny / len;
+    v.nz[v.planeCount] = nz / len;
+    v.d[v.planeCount] = (nx * px + ny * py + nz * pz) / len;
+    v.planeCount++;
+}
+
+/**
+ * Build the cockpit interior volume around the pilot eye
+ * A box sized by the cockpit scale (wide enough for a side-by-side seat when
+ * the eye is off the centreline), tightened to the cockpit object's bounds when
+ * they are known, plus a sloping windscreen plane above the panel.
+ */
+static void BuildCockpitVolume(const ShotBuildInput& input, float cockpitScale, CockpitVolume& v) {
+    float eyeX = input.dims.pilotEyeX, eyeY = input.dims.pilotEyeY, eyeZ = input.dims.pilotEyeZ;
+    float halfWidth = std::max(2.0f * std::abs(eyeX), COCKPIT_VOLUME_MIN_HALF_WIDTH * cockpitScale);
+    float lo[3] = {-halfWidth, eyeY - COCKPIT_VOLUME_DOWN * cockpitScale, eyeZ - COCKPIT_VOLUME_FORWARD * cockpitScale};
+    float hi[3] = {halfWidth, eyeY + COCKPIT_VOLUME_UP * cockpitScale, eyeZ + COCKPIT_VOLUME_AFT * cockpitScale};
+    
+    // Object walls only tighten the box, and never past the eye itself
+    if (input.aimAtPois && input.pois.boundsFound) {
+        float eye[3] = {eyeX, eyeY, eyeZ};
+        for (int axis = 0; axis < 3; axis++) {
+            float wallLo = input.pois.boundsMin[axis] + COCKPIT_WALL_MARGIN;
+            float wallHi = input.pois.boundsMax[axis] - COCKPIT_WALL_MARGIN;
+            if (wallLo < eye[axis] - COCKPIT_SOFT_ZONE) lo[axis] = std::max(lo[axis], wallLo);
+            if (wallHi > eye[axis] + COCKPIT_SOFT_ZONE) hi[axis] = std::min(hi[axis], wallHi);
+        }
+    }
     
-    // =====================================================
-    // COCKPIT SHOTS - These are relative to pilot eye position
-    // Scale cockpit movements based on cockpit size estimation
-    // =====================================================
-    float cockpitScale = std::sqrt(scale);  // Use sqrt for subtler scaling in cockpit
+    v.planeCount = 0;
+    AddCockpitPlane(v, -1.0f, 0.0f, 0.0f, lo[0], 0.0f, 0.0f);
+    AddCockpitPlane(v, 1.0f, 0.0f, 0.0f, hi[0], 0.0f, 0.0f);
+    AddCockpitPlane(v, 0.0f, -1.0f, 0.0f, 0.0f, lo[1], 0.0f);
+    AddCockpitPlane(v, 0.0f, 1.0f, 0.0f, 0.0f, hi[1], 0.0f);
+    AddCockpitPlane(v, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, lo[2]);
+    AddCockpitPlane(v, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, hi[2]);
+    
+    // Windscreen: from the ceiling just ahead of the eye down to the panel face at eye height
+    float topZ = eyeZ - 0.25f * (eyeZ - lo[2]);
+    AddCockpitPlane(v, 0.0f, topZ - lo[2], eyeY - hi[1], eyeX, hi[1], topZ);
+}
+
+/**
+ * Read the live pilot head position
+ * @return false if the datarefs are missing or the head is implausibly far
+ *         from the aircraft's eye point (e.g. not yet initialised)
+ */
+static bool ReadPilotHead(float& x, float& y, float& z) {
+    if (!g_drPilotX || !g_drPilotY || !g_drPilotZ) return false;
+    x = XPLMGetDataf(g_drPilotX);
+    y = XPLMGetDataf(g_drPilotY);
+    z = XPLMGetDataf(g_drPilotZ);
+    float dx = x - g_aircraftDims.pilotEyeX;
+    float dy = y - g_aircraftDims.pilotEyeY;
+    float dz = z - g_aircraftDims.pilotEyeZ;
+    return dx * dx + dy * dy + dz * dz <= HEAD_ANCHOR_MAX_OFFSET * HEAD_ANCHOR_MAX_OFFSET;
+}
+
+/**
+ * Follow the pilot head with the anchor filter
+ * Falls back to the acf_pe* eye point when disabled or when the head is
+ * unusable; the filter makes either switch a glide rather than a jump.
+ */
+static void UpdateHeadAnchor(float deltaTime) {
+    float x = g_aircraftDims.pilotEyeX, y = g_aircraftDims.pilotEyeY, z = g_aircraftDims.pilotEyeZ;
+    if (g_anchorToPilotHead && !ReadPilotHead(x, y, z)) {
+        x = g_aircraftDims.pilotEyeX;
+        y = g_aircraftDims.pilotEyeY;
+        z = g_aircraftDims.pilotEyeZ;
+    }
+    HeadAnchorState& anchor = g_headAnchor;
+    if (!anchor.valid) {
+        anchor = {x, y, z, true};
+        return;
+    }
+    float alpha = 1.0f - std::exp(-deltaTime / HEAD_ANCHOR_SMOOTHING_TIME);
+    anchor.x += (x - anchor.x) * alpha;
+    anchor.y += (y - anchor.y) * alpha;
+    anchor.z += (z - anchor.z) * alpha;
+}
+
+/**
+ * Jump the anchor filter to the current head position (or eye point)
+ */
+static void SnapHeadAnchor() {
+    g_headAnchor.valid = false;
+    UpdateHeadAnchor(0.0f);
+}
+
+/**
+ * Hold a cockpit camera position inside the cockpit volume
+ * Each plane is a soft wall: within COCKPIT_SOFT_ZONE of it the position is
+ * compressed exponentially, so it approaches the wall but never crosses it.
+ */
+static void ConstrainToCockpitVolume(const CockpitVolume& v, float& x, float& y, float& z) {
+    for (int i = 0; i < v.planeCount; i++) {
+        float u = v.nx[i] * x + v.ny[i] * y + v.nz[i] * z - v.d[i] + COCKPIT_SOFT_ZONE;
+        if (u <= 0.0f) continue;
+        float push = u - COCKPIT_SOFT_ZONE * (1.0f - std::exp(-u / COCKPIT_SOFT_ZONE));
+        x -= v.nx[i] * push;
+        y -= v.ny[i] * push;
+        z -= v.nz[i] * push;
+    }
+}
+
+/**
+ * Build a wingman shot flying a formation slot given in aircraft coordinates
+ * The base pose is the settled slot, aimed at the aircraft, so code reading
+ * x/y/z and pitch/heading (e.g. cut targets) gets a sensible pose
+ */
+static CameraShot MakeWingmanShot(const char* name, float slotX, float slotY, float slotZ,
+                                  float zoom, float duration) {
+    float horizontal = std::sqrt(slotX * slotX + slotZ * slotZ);
+    CameraShot shot = {CameraType::External, slotX, slotY, slotZ,
+                       -std::atan2(slotY, horizontal) * 180.0f / PI, std::atan2(-slotX, slotZ) * 180.0f / PI, 0.0f,
+                       zoom, duration, name,
+                       0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    shot.motion = ShotMotion::Wingman;
+    return shot;
+}
+
+/**
+ * Generate dynamic camera shots based on aircraft dimensions
+ * This calculates camera positions relative to the aircraft's actual size
+ * 
+ * Camera positioning principles:
+ * 1. External shots are positioned based on aircraft size (wingspan, fuselage length, height)
+ * 2. Camera should never clip into the aircraft model
+ * 3. Each shot provides a visually distinct perspective
+ * 4. Zoom levels are calculated to keep aircraft well-framed
+ * 5. Drift amounts create smooth, cinematic camera movement
+ * 
+ * Builds on the sim thread from the current subject and makes the table
+ * current straight away.
+ */
+static void GenerateDynamicCameraShots() {
+    PublishShotTable(BuildShotTable(SnapshotShotBuildInput()));
+    AdoptPendingShotTable();
+}
+
+/**
+ * Copy the shot table builder's inputs (sim thread)
+ * Supersedes every input copied before: tables built from those are dropped.
+ */
+static ShotBuildInput SnapshotShotBuildInput() {
+    ShotBuildInput input;
+    input.dims = g_aircraftDims;
+    
+    // The POIs belong to the user aircraft - a spectated target's cockpit is never shown
+    const CockpitPois* pois = PublishedPois();
+    if (pois && g_spectator.slot <= 0) {
+        input.pois = *pois;
+        input.aimAtPois = true;
+    }
+    input.generation = ++g_shotTableGeneration;
+    return input;
+}
+
+/**
+ * Build a shot table sized for the input's subject
+ * Reads nothing but the input, so it may run on any thread.
+ */
+static ShotTable* BuildShotTable(const ShotBuildInput& input) {
+    // Get scale factor based on aircraft size
+    const AircraftDimensions& dims = input.dims;
+    float scale = dims.getScaleFactor();
+    float wingspan = dims.wingspan;
+    float fuselageLen = dims.fuselageLength;
+    float height = dims.height;
+    
+    // Build a new table; readers keep using the published one until it is swapped in
+    ShotTable* table = new ShotTable();
+    table->scale = scale;
+    table->generation = input.generation;
+    ShotList& cockpitShots = table->cockpit;
+    ShotList& externalShots = table->external;
+    
+    // =====================================================
+    // COCKPIT SHOTS - These are relative to pilot eye position
+    // Scale cockpit movements based on cockpit size estimation
+    // =====================================================
+    float cockpitScale = std::sqrt(scale);  // Use sqrt for subtler scaling in cockpit
     
     // Center panel view - main instrument scan position
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.0f, 0.12f * cockpitScale, 0.35f * cockpitScale,
-                              -10.0f, 0.0f, 0.0f, 1.0f, 9.0f, "Center Panel",
-                              0.0f, 0.008f, 0.015f, 0.15f, 0.0f, 0.0f, 0.025f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.0f, 0.12f * cockpitScale, 0.35f * cockpitScale,
+                            -10.0f, 0.0f, 0.0f, 1.0f, 9.0f, "Center Panel",
+                            0.0f, 0.008f, 0.015f, 0.15f, 0.0f, 0.0f, 0.025f});
     
     // Left panel - throttle quadrant area
-    g_cockpitShots.push_back({CameraType::Cockpit, -0.22f * cockpitScale, 0.08f * cockpitScale, 0.25f * cockpitScale,
-                              -15.0f, -30.0f, 0.0f, 1.15f, 8.0f, "Left Panel",
-                              0.008f, 0.0f, 0.01f, 0.12f, 0.8f, 0.0f, 0.02f});
+    cockpitShots.push_back({CameraType::Cockpit, -0.22f * cockpitScale, 0.08f * cockpitScale, 0.25f * cockpitScale,
+                            -15.0f, -30.0f, 0.0f, 1.15f, 8.0f, "Left Panel",
+                            0.008f, 0.0f, 0.01f, 0.12f, 0.8f, 0.0f, 0.02f});
     
     // Right panel - radio/FMS area
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.22f * cockpitScale, 0.08f * cockpitScale, 0.25f * cockpitScale,
-                              -15.0f, 30.0f, 0.0f, 1.15f, 8.0f, "Right Panel",
-                              -0.008f, 0.0f, 0.01f, 0.12f, -0.8f, 0.0f, 0.02f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.22f * cockpitScale, 0.08f * cockpitScale, 0.25f * cockpitScale,
+                            -15.0f, 30.0f, 0.0f, 1.15f, 8.0f, "Right Panel",
+                            -0.008f, 0.0f, 0.01f, 0.12f, -0.8f, 0.0f, 0.02f});
     
     // Overhead panel - looking up at switches
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.0f, 0.30f * cockpitScale, 0.12f * cockpitScale,
-                              -50.0f, 0.0f, 0.0f, 1.05f, 7.0f, "Overhead Panel",
-                              0.0f, -0.008f, 0.008f, 1.2f, 0.0f, 0.0f, 0.015f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.0f, 0.30f * cockpitScale, 0.12f * cockpitScale,
+                            -50.0f, 0.0f, 0.0f, 1.05f, 7.0f, "Overhead Panel",
+                            0.0f, -0.008f, 0.008f, 1.2f, 0.0f, 0.0f, 0.015f});
     
     // PFD closeup - primary flight display focus
-    g_cockpitShots.push_back({CameraType::Cockpit, -0.10f * cockpitScale, 0.04f * cockpitScale, 0.40f * cockpitScale,
-                              -5.0f, -10.0f, 0.0f, 1.5f, 9.0f, "PFD View",
-                              0.004f, 0.004f, 0.012f, 0.08f, 0.25f, 0.0f, 0.035f});
+    cockpitShots.push_back({CameraType::Cockpit, -0.10f * cockpitScale, 0.04f * cockpitScale, 0.40f * cockpitScale,
+                            -5.0f, -10.0f, 0.0f, 1.5f, 9.0f, "PFD View",
+                            0.004f, 0.004f, 0.012f, 0.08f, 0.25f, 0.0f, 0.035f});
     
     // ND/MFD view - navigation display focus
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.10f * cockpitScale, 0.04f * cockpitScale, 0.40f * cockpitScale,
-                              -5.0f, 10.0f, 0.0f, 1.5f, 9.0f, "ND View",
-                              -0.004f, 0.004f, 0.012f, 0.08f, -0.25f, 0.0f, 0.035f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.10f * cockpitScale, 0.04f * cockpitScale, 0.40f * cockpitScale,
+                            -5.0f, 10.0f, 0.0f, 1.5f, 9.0f, "ND View",
+                            -0.004f, 0.004f, 0.012f, 0.08f, -0.25f, 0.0f, 0.035f});
     
     // Pilot forward view - looking out windscreen
-    g_cockpitShots.push_back({CameraType::Cockpit, -0.08f * cockpitScale, 0.20f * cockpitScale, -0.08f * cockpitScale,
-                              5.0f, 3.0f, 0.0f, 0.85f, 11.0f, "Pilot View",
-                              0.004f, 0.0f, 0.0f, 0.0f, 0.6f, 0.0f, 0.0f});
+    cockpitShots.push_back({CameraType::Cockpit, -0.08f * cockpitScale, 0.20f * cockpitScale, -0.08f * cockpitScale,
+                            5.0f, 3.0f, 0.0f, 0.85f, 11.0f, "Pilot View",
+                            0.004f, 0.0f, 0.0f, 0.0f, 0.6f, 0.0f, 0.0f});
     
     // Co-pilot perspective
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.30f * cockpitScale, 0.18f * cockpitScale, 0.0f,
-                              2.0f, -15.0f, 0.0f, 0.90f, 9.0f, "Copilot View",
-                              -0.008f, 0.0f, 0.0f, 0.0f, 0.4f, 0.0f, 0.008f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.30f * cockpitScale, 0.18f * cockpitScale, 0.0f,
+                            2.0f, -15.0f, 0.0f, 0.90f, 9.0f, "Copilot View",
+                            -0.008f, 0.0f, 0.0f, 0.0f, 0.4f, 0.0f, 0.008f});
     
     // Left window view - scenic exterior
-    g_cockpitShots.push_back({CameraType::Cockpit, -0.30f * cockpitScale, 0.12f * cockpitScale, 0.0f,
-                              5.0f, -80.0f, 0.0f, 0.80f, 10.0f, "Left Window",
-                              0.0f, 0.008f, 0.0f, -0.2f, 1.5f, 0.0f, 0.0f});
+    cockpitShots.push_back({CameraType::Cockpit, -0.30f * cockpitScale, 0.12f * cockpitScale, 0.0f,
+                            5.0f, -80.0f, 0.0f, 0.80f, 10.0f, "Left Window",
+                            0.0f, 0.008f, 0.0f, -0.2f, 1.5f, 0.0f, 0.0f});
     
     // Right window view - scenic exterior
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.30f * cockpitScale, 0.12f * cockpitScale, 0.0f,
-                              5.0f, 80.0f, 0.0f, 0.80f, 10.0f, "Right Window",
-                              0.0f, 0.008f, 0.0f, -0.2f, -1.5f, 0.0f, 0.0f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.30f * cockpitScale, 0.12f * cockpitScale, 0.0f,
+                            5.0f, 80.0f, 0.0f, 0.80f, 10.0f, "Right Window",
+                            0.0f, 0.008f, 0.0f, -0.2f, -1.5f, 0.0f, 0.0f});
     
     // Pedestal/center console view - MCDU/throttles
-    g_cockpitShots.push_back({CameraType::Cockpit, 0.0f, -0.05f * cockpitScale, 0.30f * cockpitScale,
-                              -40.0f, 0.0f, 0.0f, 1.3f, 7.0f, "Pedestal View",
-                              0.0f, 0.008f, 0.008f, 0.4f, 0.0f, 0.0f, 0.025f});
+    cockpitShots.push_back({CameraType::Cockpit, 0.0f, -0.05f * cockpitScale, 0.30f * cockpitScale,
+                            -40.0f, 0.0f, 0.0f, 1.3f, 7.0f, "Pedestal View",
+                            0.0f, 0.008f, 0.008f, 0.4f, 0.0f, 0.0f, 0.025f});
     
     // =====================================================
     // EXTERNAL SHOTS - Scaled based on aircraft dimensions
@@ -873,7 +1990,7 @@ static void GenerateDynamicCameraShots() {
     // =====================================================
     
     // Calculate safe distances based on aircraft size
-    float minVisibleDist = CalculateMinVisibleDistance();
+    float minVisibleDist = CalculateMinVisibleDistance(dims);
     
     // Base distances proportional to aircraft dimensions
     float frontDist = std::max(fuselageLen * 1.4f, minVisibleDist);       // Front shots
@@ -887,153 +2004,246 @@ static void GenerateDynamicCameraShots() {
     float driftScale = 0.7f + scale * 0.3f;
     
     // Calculate intelligent zoom for external shots
-    float baseZoom = CalculateIntelligentZoom(0.80f, midDist);
-    float closeZoom = CalculateIntelligentZoom(0.95f, closeDist);
-    float wideZoom = CalculateIntelligentZoom(0.65f, highDist);
-    float frontZoom = CalculateIntelligentZoom(0.85f, frontDist);
+    float baseZoom = CalculateIntelligentZoom(dims, 0.80f, midDist);
+    float closeZoom = CalculateIntelligentZoom(dims, 0.95f, closeDist);
+    float wideZoom = CalculateIntelligentZoom(dims, 0.65f, highDist);
+    float frontZoom = CalculateIntelligentZoom(dims, 0.85f, frontDist);
     
     // ---- HERO SHOTS (Dramatic main angles) ----
     
     // Front Hero - Classic nose-on shot, slightly elevated
-    g_externalShots.push_back({CameraType::External,
-                               wingspan * 0.12f, height * 0.8f, -frontDist,
-                               8.0f, 178.0f, 0.0f, frontZoom, 11.0f, "Front Hero",
-                               -0.08f * driftScale, 0.10f * driftScale, 0.20f * driftScale,
-                               -0.20f, 0.25f, 0.0f, 0.008f});
+    externalShots.push_back({CameraType::External,
+                             wingspan * 0.12f, height * 0.8f, -frontDist,
+                             8.0f, 178.0f, 0.0f, frontZoom, 11.0f, "Front Hero",
+                             -0.08f * driftScale, 0.10f * driftScale, 0.20f * driftScale,
+                             -0.20f, 0.25f, 0.0f, 0.008f});
     
     // Rear Chase - Following shot from behind
-    g_externalShots.push_back({CameraType::External,
-                               -wingspan * 0.15f, height * 1.1f, rearDist,
-                               12.0f, 5.0f, 0.0f, baseZoom, 12.0f, "Rear Chase",
-                               0.12f * driftScale, 0.06f * driftScale, -0.15f * driftScale,
-                               -0.12f, -0.30f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -wingspan * 0.15f, height * 1.1f, rearDist,
+                             12.0f, 5.0f, 0.0f, baseZoom, 12.0f, "Rear Chase",
+                             0.12f * driftScale, 0.06f * driftScale, -0.15f * driftScale,
+                             -0.12f, -0.30f, 0.0f, 0.0f});
     
     // High Wide - Establishing shot from above
-    g_externalShots.push_back({CameraType::External,
-                               wingspan * 0.3f, highDist * 1.5f, fuselageLen * 0.5f,
-                               55.0f, -20.0f, 0.0f, wideZoom, 14.0f, "High Wide",
-                               -0.25f * driftScale, 0.02f * driftScale, 0.0f,
-                               0.0f, 1.8f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             wingspan * 0.3f, highDist * 1.5f, fuselageLen * 0.5f,
+                             55.0f, -20.0f, 0.0f, wideZoom, 14.0f, "High Wide",
+                             -0.25f * driftScale, 0.02f * driftScale, 0.0f,
+                             0.0f, 1.8f, 0.0f, 0.0f});
     
     // ---- FLYBY SHOTS (Side sweep angles) ----
     
     // Left Flyby - Dramatic side sweep
-    g_externalShots.push_back({CameraType::External,
-                               -sideDist, height * 0.5f, fuselageLen * 0.3f,
-                               4.0f, 85.0f, 1.5f, baseZoom, 13.0f, "Left Flyby",
-                               0.40f * driftScale, 0.08f * driftScale, -0.50f * driftScale,
-                               0.0f, 0.8f, -0.08f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -sideDist, height * 0.5f, fuselageLen * 0.3f,
+                             4.0f, 85.0f, 1.5f, baseZoom, 13.0f, "Left Flyby",
+                             0.40f * driftScale, 0.08f * driftScale, -0.50f * driftScale,
+                             0.0f, 0.8f, -0.08f, 0.0f});
     
     // Right Flyby - Dramatic side sweep
-    g_externalShots.push_back({CameraType::External,
-                               sideDist, height * 0.5f, fuselageLen * 0.3f,
-                               4.0f, -85.0f, -1.5f, baseZoom, 13.0f, "Right Flyby",
-                               -0.40f * driftScale, 0.08f * driftScale, -0.50f * driftScale,
-                               0.0f, -0.8f, 0.08f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             sideDist, height * 0.5f, fuselageLen * 0.3f,
+                             4.0f, -85.0f, -1.5f, baseZoom, 13.0f, "Right Flyby",
+                             -0.40f * driftScale, 0.08f * driftScale, -0.50f * driftScale,
+                             0.0f, -0.8f, 0.08f, 0.0f});
     
     // ---- QUARTER ANGLE SHOTS (45-degree views) ----
     
     // Quarter Front Left - Approaching from front-left
-    g_externalShots.push_back({CameraType::External,
-                               -midDist * 0.9f, height * 1.0f, -frontDist * 0.85f,
-                               12.0f, 140.0f, -0.5f, frontZoom * 0.95f, 11.0f, "Quarter FL",
-                               0.20f * driftScale, 0.05f * driftScale, 0.25f * driftScale,
-                               -0.10f, -0.60f, 0.04f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -midDist * 0.9f, height * 1.0f, -frontDist * 0.85f,
+                             12.0f, 140.0f, -0.5f, frontZoom * 0.95f, 11.0f, "Quarter FL",
+                             0.20f * driftScale, 0.05f * driftScale, 0.25f * driftScale,
+                             -0.10f, -0.60f, 0.04f, 0.0f});
     
     // Quarter Front Right - Approaching from front-right
-    g_externalShots.push_back({CameraType::External,
-                               midDist * 0.9f, height * 1.0f, -frontDist * 0.85f,
-                               12.0f, -140.0f, 0.5f, frontZoom * 0.95f, 11.0f, "Quarter FR",
-                               -0.20f * driftScale, 0.05f * driftScale, 0.25f * driftScale,
-                               -0.10f, 0.60f, -0.04f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             midDist * 0.9f, height * 1.0f, -frontDist * 0.85f,
+                             12.0f, -140.0f, 0.5f, frontZoom * 0.95f, 11.0f, "Quarter FR",
+                             -0.20f * driftScale, 0.05f * driftScale, 0.25f * driftScale,
+                             -0.10f, 0.60f, -0.04f, 0.0f});
     
     // Quarter Rear Left - Departure view from rear-left
-    g_externalShots.push_back({CameraType::External,
-                               -midDist * 0.8f, height * 1.4f, rearDist * 0.85f,
-                               18.0f, 40.0f, 1.5f, baseZoom * 0.92f, 11.0f, "Quarter RL",
-                               0.18f * driftScale, 0.04f * driftScale, -0.18f * driftScale,
-                               -0.15f, -0.50f, -0.08f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -midDist * 0.8f, height * 1.4f, rearDist * 0.85f,
+                             18.0f, 40.0f, 1.5f, baseZoom * 0.92f, 11.0f, "Quarter RL",
+                             0.18f * driftScale, 0.04f * driftScale, -0.18f * driftScale,
+                             -0.15f, -0.50f, -0.08f, 0.0f});
     
     // Quarter Rear Right - Departure view from rear-right
-    g_externalShots.push_back({CameraType::External,
-                               midDist * 0.8f, height * 1.4f, rearDist * 0.85f,
-                               18.0f, -40.0f, -1.5f, baseZoom * 0.92f, 11.0f, "Quarter RR",
-                               -0.18f * driftScale, 0.04f * driftScale, -0.18f * driftScale,
-                               -0.15f, 0.50f, 0.08f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             midDist * 0.8f, height * 1.4f, rearDist * 0.85f,
+                             18.0f, -40.0f, -1.5f, baseZoom * 0.92f, 11.0f, "Quarter RR",
+                             -0.18f * driftScale, 0.04f * driftScale, -0.18f * driftScale,
+                             -0.15f, 0.50f, 0.08f, 0.0f});
     
     // ---- CLOSE-UP SHOTS (Detail views) ----
     
     // Wing Left Close - Wing and engine detail
-    g_externalShots.push_back({CameraType::External,
-                               -closeDist * 0.9f, height * 0.4f, fuselageLen * 0.15f,
-                               8.0f, 65.0f, -2.0f, closeZoom, 9.0f, "Wing Left",
-                               0.08f * driftScale, 0.03f * driftScale, -0.10f * driftScale,
-                               0.0f, 0.50f, 0.12f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -closeDist * 0.9f, height * 0.4f, fuselageLen * 0.15f,
+                             8.0f, 65.0f, -2.0f, closeZoom, 9.0f, "Wing Left",
+                             0.08f * driftScale, 0.03f * driftScale, -0.10f * driftScale,
+                             0.0f, 0.50f, 0.12f, 0.0f});
     
     // Wing Right Close - Wing and engine detail
-    g_externalShots.push_back({CameraType::External,
-                               closeDist * 0.9f, height * 0.4f, fuselageLen * 0.15f,
-                               8.0f, -65.0f, 2.0f, closeZoom, 9.0f, "Wing Right",
-                               -0.08f * driftScale, 0.03f * driftScale, -0.10f * driftScale,
-                               0.0f, -0.50f, -0.12f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             closeDist * 0.9f, height * 0.4f, fuselageLen * 0.15f,
+                             8.0f, -65.0f, 2.0f, closeZoom, 9.0f, "Wing Right",
+                             -0.08f * driftScale, 0.03f * driftScale, -0.10f * driftScale,
+                             0.0f, -0.50f, -0.12f, 0.0f});
     
     // Engine Left - Engine nacelle focus
-    g_externalShots.push_back({CameraType::External,
-                               -wingspan * 0.35f, height * 0.2f, -fuselageLen * 0.05f,
-                               6.0f, 70.0f, 0.0f, closeZoom * 1.15f, 8.0f, "Engine L",
-                               0.05f * driftScale, 0.025f * driftScale, -0.08f * driftScale,
-                               0.0f, 0.35f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -wingspan * 0.35f, height * 0.2f, -fuselageLen * 0.05f,
+                             6.0f, 70.0f, 0.0f, closeZoom * 1.15f, 8.0f, "Engine L",
+                             0.05f * driftScale, 0.025f * driftScale, -0.08f * driftScale,
+                             0.0f, 0.35f, 0.0f, 0.0f});
     
     // Engine Right - Engine nacelle focus
-    g_externalShots.push_back({CameraType::External,
-                               wingspan * 0.35f, height * 0.2f, -fuselageLen * 0.05f,
-                               6.0f, -70.0f, 0.0f, closeZoom * 1.15f, 8.0f, "Engine R",
-                               -0.05f * driftScale, 0.025f * driftScale, -0.08f * driftScale,
-                               0.0f, -0.35f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             wingspan * 0.35f, height * 0.2f, -fuselageLen * 0.05f,
+                             6.0f, -70.0f, 0.0f, closeZoom * 1.15f, 8.0f, "Engine R",
+                             -0.05f * driftScale, 0.025f * driftScale, -0.08f * driftScale,
+                             0.0f, -0.35f, 0.0f, 0.0f});
     
     // Tail View - Empennage focus
-    g_externalShots.push_back({CameraType::External,
-                               -wingspan * 0.2f, height * 1.3f, rearDist * 1.2f,
-                               25.0f, 8.0f, 0.0f, baseZoom * 0.95f, 10.0f, "Tail View",
-                               0.08f * driftScale, 0.05f * driftScale, -0.10f * driftScale,
-                               -0.20f, -0.50f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -wingspan * 0.2f, height * 1.3f, rearDist * 1.2f,
+                             25.0f, 8.0f, 0.0f, baseZoom * 0.95f, 10.0f, "Tail View",
+                             0.08f * driftScale, 0.05f * driftScale, -0.10f * driftScale,
+                             -0.20f, -0.50f, 0.0f, 0.0f});
     
     // ---- SPECIALTY SHOTS (Unique angles) ----
     
     // Low Front - Dramatic low angle looking up
-    g_externalShots.push_back({CameraType::External,
-                               wingspan * 0.25f, height * 0.15f, -frontDist * 0.7f,
-                               -18.0f, 165.0f, 2.0f, frontZoom * 1.05f, 9.0f, "Low Front",
-                               -0.08f * driftScale, 0.12f * driftScale, 0.18f * driftScale,
-                               0.30f, 0.40f, -0.15f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             wingspan * 0.25f, height * 0.15f, -frontDist * 0.7f,
+                             -18.0f, 165.0f, 2.0f, frontZoom * 1.05f, 9.0f, "Low Front",
+                             -0.08f * driftScale, 0.12f * driftScale, 0.18f * driftScale,
+                             0.30f, 0.40f, -0.15f, 0.0f});
     
     // Belly View - Looking up from below
-    g_externalShots.push_back({CameraType::External,
-                               wingspan * 0.15f, -height * 0.8f, fuselageLen * 0.1f,
-                               -40.0f, -8.0f, 0.0f, baseZoom * 1.05f, 8.0f, "Belly View",
-                               -0.04f * driftScale, 0.06f * driftScale, 0.0f,
-                               0.25f, 0.35f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             wingspan * 0.15f, -height * 0.8f, fuselageLen * 0.1f,
+                             -40.0f, -8.0f, 0.0f, baseZoom * 1.05f, 8.0f, "Belly View",
+                             -0.04f * driftScale, 0.06f * driftScale, 0.0f,
+                             0.25f, 0.35f, 0.0f, 0.0f});
     
     // Side Profile - Pure side view
-    g_externalShots.push_back({CameraType::External,
-                               -sideDist * 0.85f, height * 0.6f, 0.0f,
-                               3.0f, 90.0f, 0.0f, baseZoom * 0.95f, 10.0f, "Side Profile L",
-                               0.30f * driftScale, 0.04f * driftScale, 0.0f,
-                               0.0f, 0.0f, 0.0f, 0.0f});
+    externalShots.push_back({CameraType::External,
+                             -sideDist * 0.85f, height * 0.6f, 0.0f,
+                             3.0f, 90.0f, 0.0f, baseZoom * 0.95f, 10.0f, "Side Profile L",
+                             0.30f * driftScale, 0.04f * driftScale, 0.0f,
+                             0.0f, 0.0f, 0.0f, 0.0f});
     
     // Nose Close - Cockpit window close-up
-    g_externalShots.push_back({CameraType::External,
-                               -wingspan * 0.08f, height * 0.5f, -fuselageLen * 0.55f,
-                               5.0f, 175.0f, 0.0f, closeZoom * 1.2f, 8.0f, "Nose Close",
-                               0.04f * driftScale, 0.06f * driftScale, 0.12f * driftScale,
-                               -0.08f, 0.20f, 0.0f, 0.015f});
-    
-    char msg[128];
-    snprintf(msg, sizeof(msg), "MovieCamera: Generated %zu cockpit and %zu external shots (scale: %.2f)\n",
-             g_cockpitShots.size(), g_externalShots.size(), scale);
+    externalShots.push_back({CameraType::External,
+                             -wingspan * 0.08f, height * 0.5f, -fuselageLen * 0.55f,
+                             5.0f, 175.0f, 0.0f, closeZoom * 1.2f, 8.0f, "Nose Close",
+                             0.04f * driftScale, 0.06f * driftScale, 0.12f * driftScale,
+                             -0.08f, 0.20f, 0.0f, 0.015f});
+    
+    // ---- ORBIT SHOTS (Closed-form circles around the aircraft) ----
+    
+    // High Orbit - Circling view from above, looking down at the whole airframe
+    externalShots.push_back(MakeOrbitShot("High Orbit", highDist, 32.0f, 6.0f, 135.0f,
+                                          0.0f, height * 0.3f, 0.0f, wideZoom, 14.0f));
+    
+    // Low Orbit - Slow sweep just above wing level
+    externalShots.push_back(MakeOrbitShot("Low Orbit", sideDist, 8.0f, -4.0f, -60.0f,
+                                          0.0f, height * 0.4f, 0.0f, baseZoom, 13.0f));
+    
+    // Nose Orbit - Tighter circle centered on the forward fuselage
+    externalShots.push_back(MakeOrbitShot("Nose Orbit", midDist, 14.0f, 5.0f, 200.0f,
+                                          0.0f, height * 0.4f, -fuselageLen * 0.3f, frontZoom, 11.0f));
+    
+    // ---- WINGMAN SHOTS (Camera ship flying formation) ----
+    
+    // Wingman Left - Line abreast off the left wing, slightly high
+    externalShots.push_back(MakeWingmanShot("Wingman Left", -sideDist, height * 0.4f, fuselageLen * 0.1f,
+                                            baseZoom, 14.0f));
+    
+    // Wingman Echelon - Stepped back and down on the right
+    externalShots.push_back(MakeWingmanShot("Wingman Echelon", sideDist * 0.9f, -height * 0.3f, fuselageLen * 0.7f,
+                                            baseZoom, 13.0f));
+    
+    // Photo Ship - Above and behind on the left, looking down at the planform
+    externalShots.push_back(MakeWingmanShot("Photo Ship", -sideDist * 0.8f, highDist * 0.5f, fuselageLen * 0.5f,
+                                            wideZoom, 12.0f));
+    
+    AssignShotFamilies(cockpitShots);
+    AssignShotFamilies(externalShots);
+    
+    if (input.aimAtPois) {
+        AimCockpitShotsAtPois(cockpitShots, input.pois, dims);
+        table->poisAimed = true;
+    }
+    BuildCockpitVolume(input, cockpitScale, table->cockpitVolume);
+    BuildShotColumns(cockpitShots, table->cockpitColumns, table->arena);
+    BuildShotColumns(externalShots, table->externalColumns, table->arena);
+    return table;
+}
+
+/**
+ * Hand a finished shot table over for adoption (any thread)
+ * A table published earlier but not yet adopted is superseded and freed here:
+ * the exchange makes this caller its only owner.
+ */
+static void PublishShotTable(ShotTable* table) {
+    delete g_pendingShotTable.exchange(table, std::memory_order_acq_rel);
+}
+
+/**
+ * Make the latest published shot table current (sim thread)
+ * The previous table is freed once the current shot no longer refers to it.
+ */
+static void AdoptPendingShotTable() {
+    ShotTable* table = g_pendingShotTable.exchange(nullptr, std::memory_order_acquire);
+    if (!table) return;
+    
+    // Built from inputs that have been replaced since (e.g. the subject changed)
+    if (table->generation != g_shotTableGeneration) {
+        delete table;
+        return;
+    }
+    g_shotTable.reset(table);
+    
+    char msg[160];
+    snprintf(msg, sizeof(msg), "MovieCamera: Generated %zu cockpit and %zu external shots (scale: %.2f%s)\n",
+             g_shotTable->cockpit.size(), g_shotTable->external.size(), g_shotTable->scale,
+             g_shotTable->poisAimed ? ", aimed at cockpit POIs" : "");
     XPLMDebugString(msg);
 }
 
+/**
+ * Copy a shot list into its column mirror
+ * Must follow every change to the list: selection indexes the list by row.
+ */
+static void BuildShotColumns(const ShotList& shots, ShotColumns& columns, Arena& arena) {
+    ResizeShotColumns(columns, static_cast<int>(shots.size()), arena);
+    for (int i = 0; i < columns.count; i++) {
+        const CameraShot& shot = shots[i];
+        columns.x[i] = shot.x;
+        columns.y[i] = shot.y;
+        columns.z[i] = shot.z;
+        columns.pitch[i] = shot.pitch;
+        columns.heading[i] = shot.heading;
+        columns.roll[i] = shot.roll;
+        columns.zoom[i] = shot.zoom;
+        columns.duration[i] = shot.duration;
+        columns.driftX[i] = shot.driftX;
+        columns.driftY[i] = shot.driftY;
+        columns.driftZ[i] = shot.driftZ;
+        columns.driftPitch[i] = shot.driftPitch;
+        columns.driftHeading[i] = shot.driftHeading;
+        columns.driftRoll[i] = shot.driftRoll;
+        columns.driftZoom[i] = shot.driftZoom;
+        columns.phaseMask[i] = shot.phaseMask;
+    }
+}
+
 /**
  * Update menu item states based on current plugin state
  */
@@ -1135,10 +2345,11 @@ static void TransformToWorldCoordinates(
     float p = pitch * PI / 180.0f;
     float r = roll * PI / 180.0f;
     
-    // Precompute trigonometric values
-    float cosH = std::cos(h), sinH = std::sin(h);
-    float cosP = std::cos(p), sinP = std::sin(p);
-    float cosR = std::cos(r), sinR = std::sin(r);
+    // Precompute trigonometric values (per frame: the fast path is well inside a pixel)
+    float cosH, sinH, cosP, sinP, cosR, sinR;
+    FastSinCos(h, sinH, cosH);
+    FastSinCos(p, sinP, cosP);
+    FastSinCos(r, sinR, cosR);
     
     // Combined rotation matrix (ZYX order: heading, then pitch, then roll)
     // This matches X-Plane's coordinate system conventions
@@ -1165,13 +2376,6 @@ static void TransformToWorldCoordinates(
     outZ = acfZ + z3;
 }
 
-/**
- * Ease in-out cubic for smooth transitions
- */
-static float EaseInOutCubic(float t) {
-    return std::clamp(t, 0.0f, 1.0f);
-}
-
 /**
  * Normalize angle to -180 to 180 range
  */
@@ -1227,7 +2431,10 @@ static float EnsureAboveGround(float cameraY) {
     // Method: Aircraft local_y minus y_agl (height above ground) gives terrain Y
     float terrainY = 0.0f;
     
-    if (g_drTerrainY && g_drLocalY) {
+    if (g_spectator.slot > 0) {
+        // Spectating traffic: terrain was probed under the target this frame
+        terrainY = g_spectator.terrainY;
+    } else if (g_drTerrainY && g_drLocalY) {
         float aircraftY = XPLMGetDataf(g_drLocalY);
         float agl = XPLMGetDataf(g_drTerrainY);  // y_agl is height above ground
         terrainY = aircraftY - agl;  // Calculate actual terrain Y coordinate
@@ -1257,16 +2464,17 @@ static void ValidateCameraPosition(float& worldCamX, float& worldCamY, float& wo
         return;
     }
     
-    // Calculate current distance from aircraft center in world space
+    // Calculate current distance from aircraft center in world space (squared, so
+    // the usual case of a camera far enough out costs no square root)
     float dx = worldCamX - acfX;
     float dy = worldCamY - acfY;
     float dz = worldCamZ - acfZ;
-    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
-    float minDistance = CalculateMinVisibleDistance();
+    float distanceSq = dx * dx + dy * dy + dz * dz;
+    float minDistance = CalculateMinVisibleDistance(g_aircraftDims);
     
     // If too close, scale position outward to minimum distance
-    if (distance < minDistance && distance > 0.001f) {
-        float scaleFactor = minDistance / distance;
+    if (distanceSq < minDistance * minDistance && distanceSq > 0.001f * 0.001f) {
+        float scaleFactor = minDistance * FastRsqrt(distanceSq);
         worldCamX = acfX + dx * scaleFactor;
         worldCamY = acfY + dy * scaleFactor;
         worldCamZ = acfZ + dz * scaleFactor;
@@ -1407,6 +2615,268 @@ static void RestoreCameraEffectState() {
     XPLMDebugString("MovieCamera: Camera effect state restored\n");
 }
 
+static SettingDef BoolSetting(const char* key, bool* value, bool defaultValue, const char* label) {
+    return {key, SettingType::Bool, value, 0.0f, 1.0f, defaultValue ? 1.0f : 0.0f, "%.0f",
+            SettingWidget::Checkbox, label, 0.0f, nullptr, 0};
+}
+
+static SettingDef IntSetting(const char* key, int* value, int minValue, int maxValue, int defaultValue, const char* label) {
+    return {key, SettingType::Int, value, static_cast<float>(minValue), static_cast<float>(maxValue),
+            static_cast<float>(defaultValue), "%.0f", SettingWidget::Input, label, 1.0f, nullptr, 0};
+}
+
+template <typename E>
+static SettingDef EnumSetting(const char* key, E* value, int count, E defaultValue, const char* label, const char* items) {
+    static_assert(sizeof(E) == sizeof(int), "enum settings are stored as int");
+    return {key, SettingType::Enum, value, 0.0f, static_cast<float>(count - 1),
+            static_cast<float>(static_cast<int>(defaultValue)), "%.0f", SettingWidget::Combo, label, 0.0f, items, 0};
+}
+
+static SettingDef FloatSetting(const char* key, float* value, float minValue, float maxValue, float defaultValue,
+                               const char* format, SettingWidget widget, const char* label, float step = 0.0f) {
+    return {key, SettingType::Float, value, minValue, maxValue, defaultValue, format, widget, label, step, nullptr, 0};
+}
+
+static SettingDef TextSetting(const char* key, char* value, size_t size, const char* label) {
+    return {key, SettingType::Text, value, 0.0f, 0.0f, 0.0f, "%s", SettingWidget::Input, label, 0.0f, nullptr, size};
+}
+
+static const SettingDef g_settingDefs[] = {
+    FloatSetting("delay_seconds", &g_delaySeconds, 1.0f, 300.0f, 60.0f, "%.1f", SettingWidget::Input, "##delay", 1.0f),
+    FloatSetting("auto_alt_ft", &g_autoAltFt, 0.0f, 50000.0f, 18000.0f, "%.0f", SettingWidget::Input, "##autoalt", 100.0f),
+    FloatSetting("shot_min_duration", &g_shotMinDuration, 1.0f, 30.0f, 6.0f, "%.1f", SettingWidget::Input, "##shotmin", 0.5f),
+    FloatSetting("shot_max_duration", &g_shotMaxDuration, 1.0f, 30.0f, 15.0f, "%.1f", SettingWidget::Input, "##shotmax", 0.5f),
+    EnumSetting("wingspan_source", &g_wingspanSource, 5, WingspanSource::Auto, "Wingspan Source##wsrc",
+                "Auto\0acf_size_x\0wing semilen\0Default\0Manual\0"),
+    EnumSetting("fuselage_source", &g_fuselageSource, 6, FuselageLengthSource::Auto, "Fuselage Source##fsrc",
+                "Auto\0acf_size_z\0cg range\0pilot eye Z\0Default\0Manual\0"),
+    EnumSetting("height_source", &g_heightSource, 5, HeightSource::Auto, "Height Source##hsrc",
+                "Auto\0gear + pilot\0pilot eye\0Default\0Manual\0"),
+    FloatSetting("manual_wingspan", &g_manualWingspan, MIN_WINGSPAN, MAX_WINGSPAN, STANDARD_WINGSPAN, "%.1f",
+                 SettingWidget::Input, "Wingspan (m)##wmanual", 0.5f),
+    FloatSetting("manual_fuselage_length", &g_manualFuselageLength, MIN_FUSELAGE_LENGTH, MAX_FUSELAGE_LENGTH,
+                 STANDARD_FUSELAGE_LENGTH, "%.1f", SettingWidget::Input, "Fuselage (m)##fmanual", 0.5f),
+    FloatSetting("manual_height", &g_manualHeight, MIN_HEIGHT, MAX_HEIGHT, STANDARD_HEIGHT, "%.1f",
+                 SettingWidget::Input, "Height (m)##hman", 0.2f),
+    EnumSetting("debug_shot_type", &g_debugShotType, 3, DebugShotType::Auto, "Next Shot Type##shottype",
+                "Auto\0Cockpit\0External\0"),
+    IntSetting("debug_shot_index", &g_debugShotIndex, -1, 9999, -1, "Next Shot Index##shotidx"),
+    EnumSetting("transition_style", &g_transitionStyle, 5, TransitionStyle::Auto, "Transition##transition",
+                "Auto\0Cut\0Whip-pan\0Push-in / Pull-out\0Match cut\0"),
+    FloatSetting("transition_duration", &g_transitionDuration, 0.3f, 5.0f, 1.0f, "%.1f",
+                 SettingWidget::Slider, "Transition Time (s)##transtime"),
+    BoolSetting("instrument_cues", &g_enableInstrumentCues, true, "Instrument Cues"),
+    BoolSetting("landmark_shots", &g_enableLandmarkShots, true, "Landmark Shots"),
+    BoolSetting("head_anchor", &g_anchorToPilotHead, false, "Follow Pilot Head"),
+    BoolSetting("enable_beat_sync", &g_enableBeatSync, false, "Sync Cuts to Music"),
+    FloatSetting("beat_offset", &g_beatOffset, -86400.0f, 86400.0f, 0.0f, "%.2f",
+                 SettingWidget::Input, "Track Offset (s)##beatoffset", 0.1f),
+    TextSetting("beat_audio_path", g_beatAudioPath, sizeof(g_beatAudioPath), "Audio File##beatpath"),
+    BoolSetting("enable_spectator", &g_enableSpectator, false, "Spectate Traffic"),
+    BoolSetting("spectator_director", &g_spectatorDirector, false, "Auto Director##director"),
+    
+    // Cinematic effects
+    BoolSetting("enable_fov_effect", &g_enableFovEffect, true, "Enable FOV Effect"),
+    FloatSetting("base_fov", &g_baseFov, MIN_FOV_DEG, MAX_FOV_DEG, 60.0f, "%.1f", SettingWidget::Slider, "Base FOV##fov"),
+    FloatSetting("fov_transition_speed", &g_fovTransitionSpeed, 1.0f, 30.0f, 15.0f, "%.1f",
+                 SettingWidget::Slider, "Transition Speed##fovspeed"),
+    BoolSetting("enable_handheld_effect", &g_enableHandheldEffect, false, "Enable Handheld Effect"),
+    FloatSetting("handheld_intensity", &g_handheldIntensity, 0.0f, 1.0f, 0.5f, "%.2f",
+                 SettingWidget::Slider, "Shake Intensity##shake"),
+    BoolSetting("enable_gforce_effect", &g_enableGForceEffect, false, "Enable G-Force Effect"),
+};
+
+// Profiles written to profiles.cfg when it doesn't exist yet
+static const char* const DEFAULT_PROFILES =
+    "# MovieCamera profiles\n"
+    "# [Name] starts a profile; the lines below it use the keys of settings.cfg.\n"
+    "# Settings a profile does not list keep their current value.\n"
+    "[Airshow]\n"
+    "shot_min_duration 3.0\n"
+    "shot_max_duration 7.0\n"
+    "transition_style 2\n"
+    "transition_duration 0.8\n"
+    "enable_spectator 1\n"
+    "spectator_director 1\n"
+    "base_fov 45.0\n"
+    "enable_handheld_effect 1\n"
+    "handheld_intensity 0.40\n"
+    "[Airliner]\n"
+    "shot_min_duration 8.0\n"
+    "shot_max_duration 18.0\n"
+    "transition_style 0\n"
+    "transition_duration 2.0\n"
+    "enable_spectator 0\n"
+    "instrument_cues 1\n"
+    "base_fov 60.0\n"
+    "enable_handheld_effect 0\n"
+    "[GA cruise]\n"
+    "shot_min_duration 10.0\n"
+    "shot_max_duration 25.0\n"
+    "transition_style 3\n"
+    "transition_duration 2.5\n"
+    "enable_spectator 0\n"
+    "head_anchor 1\n"
+    "base_fov 70.0\n"
+    "enable_handheld_effect 1\n"
+    "handheld_intensity 0.20\n";
+
+/**
+ * Find a setting by key (hash lookup)
+ */
+static const SettingDef* FindSetting(std::string_view key) {
+    static std::unordered_map<std::string_view, const SettingDef*> index;
+    if (index.empty()) {
+        for (const SettingDef& def : g_settingDefs) {
+            index.emplace(def.key, &def);
+        }
+    }
+    auto it = index.find(key);
+    return (it != index.end()) ? it->second : nullptr;
+}
+
+/**
+ * Write a numeric setting from a float, clamped to its range
+ */
+static void StoreSetting(const SettingDef& def, float number) {
+    number = std::clamp(number, def.minValue, def.maxValue);
+    switch (def.type) {
+        case SettingType::Bool:
+            *static_cast<bool*>(def.value) = number != 0.0f;
+            break;
+        case SettingType::Int:
+            *static_cast<int*>(def.value) = static_cast<int>(std::lround(number));
+            break;
+        case SettingType::Enum: {
+            int raw = static_cast<int>(std::lround(number));
+            std::memcpy(def.value, &raw, sizeof(raw));
+            break;
+        }
+        case SettingType::Float:
+            *static_cast<float*>(def.value) = number;
+            break;
+        case SettingType::Text:
+            break;
+    }
+}
+
+/**
+ * Read a numeric setting as a float
+ */
+static float LoadSetting(const SettingDef& def) {
+    switch (def.type) {
+        case SettingType::Bool:  return *static_cast<bool*>(def.value) ? 1.0f : 0.0f;
+        case SettingType::Int:   return static_cast<float>(*static_cast<int*>(def.value));
+        case SettingType::Enum: {
+            int raw;
+            std::memcpy(&raw, def.value, sizeof(raw));
+            return static_cast<float>(raw);
+        }
+        case SettingType::Float: return *static_cast<float*>(def.value);
+        case SettingType::Text:  break;
+    }
+    return 0.0f;
+}
+
+/**
+ * Parse a value for a setting
+ * @param text - Value text (no leading whitespace; trailing newline allowed)
+ * @return false if the value is malformed; the setting is left unchanged
+ */
+static bool ParseSettingValue(const SettingDef& def, const char* text) {
+    if (def.type == SettingType::Text) {
+        char* out = static_cast<char*>(def.value);
+        std::snprintf(out, def.textSize, "%s", text);
+        out[std::strcspn(out, "\r\n")] = '\0';
+        return true;
+    }
+    char* end = nullptr;
+    float number = std::strtof(text, &end);
+    if (end == text) return false;
+    StoreSetting(def, number);
+    return true;
+}
+
+/**
+ * Cross-setting rules the per-setting ranges can't express
+ */
+static void NormalizeSettings() {
+    if (g_shotMinDuration > g_shotMaxDuration) {
+        g_shotMinDuration = g_shotMaxDuration;
+    }
+}
+
+static void ResetSettingsToDefaults() {
+    for (const SettingDef& def : g_settingDefs) {
+        if (def.type == SettingType::Text) {
+            static_cast<char*>(def.value)[0] = '\0';
+        } else {
+            StoreSetting(def, def.defaultValue);
+        }
+    }
+}
+
+/**
+ * Split a "key value" line and apply it
+ * @return false for comments, unknown keys and malformed values
+ */
+static bool ApplySettingLine(const char* line) {
+    while (*line == ' ' || *line == '\t') line++;
+    if (*line == '#' || *line == '\0') return false;
+    size_t keyLength = std::strcspn(line, " \t\r\n");
+    const SettingDef* def = FindSetting(std::string_view(line, keyLength));
+    if (!def) return false;
+    const char* value = line + keyLength;
+    while (*value == ' ' || *value == '\t') value++;
+    return ParseSettingValue(*def, value);
+}
+
+/**
+ * Draw the widget of a setting as declared in the schema
+ * Layout (width, tooltips, sections) stays with the caller.
+ * @return true if the user changed the value
+ */
+static bool SettingWidgetUi(const char* key) {
+    const SettingDef* def = FindSetting(key);
+    if (!def) return false;
+    
+    bool changed = false;
+    switch (def->widget) {
+        case SettingWidget::Checkbox:
+            changed = ImGui::Checkbox(def->label, static_cast<bool*>(def->value));
+            break;
+        case SettingWidget::Slider:
+            changed = ImGui::SliderFloat(def->label, static_cast<float*>(def->value), def->minValue, def->maxValue, def->format);
+            break;
+        case SettingWidget::Input:
+            if (def->type == SettingType::Text) {
+                changed = ImGui::InputText(def->label, static_cast<char*>(def->value), def->textSize);
+            } else if (def->type == SettingType::Int) {
+                changed = ImGui::InputInt(def->label, static_cast<int*>(def->value));
+            } else {
+                changed = ImGui::InputFloat(def->label, static_cast<float*>(def->value), def->step, def->step * 10.0f, def->format);
+            }
+            break;
+        case SettingWidget::Combo: {
+            int current = static_cast<int>(LoadSetting(*def));
+            changed = ImGui::Combo(def->label, &current, def->items);
+            if (changed) StoreSetting(*def, static_cast<float>(current));
+            break;
+        }
+        case SettingWidget::None:
+            break;
+    }
+    
+    if (changed) {
+        if (def->type != SettingType::Text) {
+            StoreSetting(*def, LoadSetting(*def));
+        }
+        NormalizeSettings();
+        g_activeProfile = -1;
+    }
+    return changed;
+}
+
 /**
  * Save plugin settings to a file
  */
@@ -1420,26 +2890,18 @@ static void SaveSettings() {
     
     fprintf(file, "# MovieCamera Settings\n");
     fprintf(file, "version 4\n");
-    fprintf(file, "delay_seconds %.1f\n", g_delaySeconds);
-    fprintf(file, "auto_alt_ft %.0f\n", g_autoAltFt);
-    fprintf(file, "shot_min_duration %.1f\n", g_shotMinDuration);
-    fprintf(file, "shot_max_duration %.1f\n", g_shotMaxDuration);
-    fprintf(file, "wingspan_source %d\n", static_cast<int>(g_wingspanSource));
-    fprintf(file, "fuselage_source %d\n", static_cast<int>(g_fuselageSource));
-    fprintf(file, "height_source %d\n", static_cast<int>(g_heightSource));
-    fprintf(file, "manual_wingspan %.1f\n", g_manualWingspan);
-    fprintf(file, "manual_fuselage_length %.1f\n", g_manualFuselageLength);
-    fprintf(file, "manual_height %.1f\n", g_manualHeight);
-    fprintf(file, "debug_shot_type %d\n", static_cast<int>(g_debugShotType));
-    fprintf(file, "debug_shot_index %d\n", g_debugShotIndex);
-    
-    // Cinematic effects settings
-    fprintf(file, "enable_fov_effect %d\n", g_enableFovEffect ? 1 : 0);
-    fprintf(file, "base_fov %.1f\n", g_baseFov);
-    fprintf(file, "fov_transition_speed %.1f\n", g_fovTransitionSpeed);
-    fprintf(file, "enable_handheld_effect %d\n", g_enableHandheldEffect ? 1 : 0);
-    fprintf(file, "handheld_intensity %.2f\n", g_handheldIntensity);
-    fprintf(file, "enable_gforce_effect %d\n", g_enableGForceEffect ? 1 : 0);
+    for (const SettingDef& def : g_settingDefs) {
+        if (def.type == SettingType::Text) {
+            const char* text = static_cast<const char*>(def.value);
+            if (text[0] != '\0') fprintf(file, "%s %s\n", def.key, text);
+        } else if (def.type == SettingType::Float) {
+            fprintf(file, "%s ", def.key);
+            fprintf(file, def.format, LoadSetting(def));
+            fprintf(file, "\n");
+        } else {
+            fprintf(file, "%s %d\n", def.key, static_cast<int>(LoadSetting(def)));
+        }
+    }
     
     fclose(file);
     XPLMDebugString("MovieCamera: Settings saved\n");
@@ -1447,8 +2909,11 @@ static void SaveSettings() {
 
 /**
  * Load plugin settings from a file
+ * Settings missing from the file get their schema defaults.
  */
 static void LoadSettings() {
+    ResetSettingsToDefaults();
+    
     std::string path = GetPluginPath() + "settings.cfg";
     FILE* file = fopen(path.c_str(), "r");
     if (!file) {
@@ -1456,162 +2921,716 @@ static void LoadSettings() {
         return;
     }
     
-    char line[256];
+    char line[BEAT_PATH_MAX + 64];
     while (fgets(line, sizeof(line), file)) {
-        if (line[0] == '#') continue;
-        
-        float value;
-        int intValue;
-        if (sscanf(line, "delay_seconds %f", &value) == 1) {
-            g_delaySeconds = std::clamp(value, 1.0f, 300.0f);
-        } else if (sscanf(line, "auto_alt_ft %f", &value) == 1) {
-            g_autoAltFt = std::clamp(value, 0.0f, 50000.0f);
-        } else if (sscanf(line, "shot_min_duration %f", &value) == 1) {
-            g_shotMinDuration = std::clamp(value, 1.0f, 30.0f);
-        } else if (sscanf(line, "shot_max_duration %f", &value) == 1) {
-            g_shotMaxDuration = std::clamp(value, 1.0f, 30.0f);
-        } else if (sscanf(line, "wingspan_source %d", &intValue) == 1) {
-            intValue = std::clamp(intValue, 0, 4);
-            g_wingspanSource = static_cast<WingspanSource>(intValue);
-        } else if (sscanf(line, "fuselage_source %d", &intValue) == 1) {
-            intValue = std::clamp(intValue, 0, 5);
-            g_fuselageSource = static_cast<FuselageLengthSource>(intValue);
-        } else if (sscanf(line, "height_source %d", &intValue) == 1) {
-            intValue = std::clamp(intValue, 0, 4);
-            g_heightSource = static_cast<HeightSource>(intValue);
-        } else if (sscanf(line, "manual_wingspan %f", &value) == 1) {
-            g_manualWingspan = std::clamp(value, MIN_WINGSPAN, MAX_WINGSPAN);
-        } else if (sscanf(line, "manual_fuselage_length %f", &value) == 1) {
-            g_manualFuselageLength = std::clamp(value, MIN_FUSELAGE_LENGTH, MAX_FUSELAGE_LENGTH);
-        } else if (sscanf(line, "manual_height %f", &value) == 1) {
-            g_manualHeight = std::clamp(value, MIN_HEIGHT, MAX_HEIGHT);
-        } else if (sscanf(line, "debug_shot_type %d", &intValue) == 1) {
-            intValue = std::clamp(intValue, 0, 2);
-            g_debugShotType = static_cast<DebugShotType>(intValue);
-        } else if (sscanf(line, "debug_shot_index %d", &intValue) == 1) {
-            g_debugShotIndex = std::max(-1, intValue);
-        } else if (sscanf(line, "enable_fov_effect %d", &intValue) == 1) {
-            g_enableFovEffect = (intValue != 0);
-        } else if (sscanf(line, "base_fov %f", &value) == 1) {
-            g_baseFov = std::clamp(value, MIN_FOV_DEG, MAX_FOV_DEG);
-        } else if (sscanf(line, "fov_transition_speed %f", &value) == 1) {
-            g_fovTransitionSpeed = std::clamp(value, 1.0f, 30.0f);
-        } else if (sscanf(line, "enable_handheld_effect %d", &intValue) == 1) {
-            g_enableHandheldEffect = (intValue != 0);
-        } else if (sscanf(line, "handheld_intensity %f", &value) == 1) {
-            g_handheldIntensity = std::clamp(value, 0.0f, 1.0f);
-        } else if (sscanf(line, "enable_gforce_effect %d", &intValue) == 1) {
-            g_enableGForceEffect = (intValue != 0);
-        }
-    }
-    
-    // Ensure min <= max
-    if (g_shotMinDuration > g_shotMaxDuration) {
-        g_shotMinDuration = g_shotMaxDuration;
+        ApplySettingLine(line);
     }
+    NormalizeSettings();
     
     fclose(file);
     XPLMDebugString("MovieCamera: Settings loaded\n");
 }
 
 /**
- * Select the next camera shot
+ * Parse profiles text: "[Name]" headers followed by setting lines
  */
-static CameraShot SelectNextShot() {
-    std::vector<CameraShot>* shotList = nullptr;
-    bool canSwitchType = g_consecutiveSameTypeCount >= 3;
-    
-    // Determine which shot type to use
-    CameraType nextType;
-    if (g_debugShotType == DebugShotType::Cockpit) {
-        nextType = CameraType::Cockpit;
-    } else if (g_debugShotType == DebugShotType::External) {
-        nextType = CameraType::External;
-    } else if (canSwitchType) {
-        // Can switch types - randomly decide
-        nextType = (std::rand() % 2 == 0) ? CameraType::Cockpit : CameraType::External;
-    } else {
-        // Must continue with same type
-        nextType = g_lastShotType;
+static void ParseProfiles(const std::string& text) {
+    g_profiles.clear();
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t eol = text.find('\n', pos);
+        if (eol == std::string::npos) eol = text.size();
+        std::string line = text.substr(pos, eol - pos);
+        pos = eol + 1;
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#') continue;
+        
+        if (line[first] == '[') {
+            size_t close = line.find(']', first);
+            g_profiles.push_back({line.substr(first + 1, (close == std::string::npos ? line.size() : close) - first - 1), {}});
+            continue;
+        }
+        size_t keyEnd = line.find_first_of(" \t", first);
+        std::string key = line.substr(first, keyEnd == std::string::npos ? std::string::npos : keyEnd - first);
+        const SettingDef* def = FindSetting(key);
+        if (!def || g_profiles.empty()) {
+            char msg[160];
+            snprintf(msg, sizeof(msg), "MovieCamera: Ignoring profile line '%s'\n", line.c_str());
+            XPLMDebugString(msg);
+            continue;
+        }
+        size_t valueStart = (keyEnd == std::string::npos) ? line.size() : line.find_first_not_of(" \t", keyEnd);
+        g_profiles.back().values.emplace_back(def, valueStart == std::string::npos ? "" : line.substr(valueStart));
     }
-    
-    // Select the appropriate shot list
-    if (nextType == CameraType::Cockpit) {
-        shotList = &g_cockpitShots;
+}
+
+/**
+ * Read profiles.cfg (created with sample profiles if missing) and add the
+ * built-in Defaults profile
+ */
+static void LoadProfiles() {
+    std::string path = GetPluginPath() + "profiles.cfg";
+    std::string text;
+    FILE* file = fopen(path.c_str(), "r");
+    if (file) {
+        char buffer[512];
+        size_t bytes;
+        while ((bytes = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+            text.append(buffer, bytes);
+        }
+        fclose(file);
     } else {
-        shotList = &g_externalShots;
+        text = DEFAULT_PROFILES;
+        file = fopen(path.c_str(), "w");
+        if (file) {
+            fputs(DEFAULT_PROFILES, file);
+            fclose(file);
+        }
     }
-    
-    // Update tracking
-    if (nextType != g_lastShotType) {
-        g_consecutiveSameTypeCount = 1;
-        g_lastShotType = nextType;
-    } else {
-        g_consecutiveSameTypeCount++;
+    ParseProfiles(text);
+    
+    SettingsProfile defaults{"Defaults", {}};
+    for (const SettingDef& def : g_settingDefs) {
+        if (def.type == SettingType::Text) continue;
+        char value[32];
+        snprintf(value, sizeof(value), "%g", def.defaultValue);
+        defaults.values.emplace_back(&def, value);
     }
+    g_profiles.push_back(std::move(defaults));
+    g_activeProfile = -1;
     
-    // Select a random shot from the list (avoid same shot twice)
-    if (shotList->empty()) {
-        // Fallback - include drift values
-        return {CameraType::Cockpit, 0, 0, 0, 0, 0, 0, 1.0f, 4.0f, "Default",
-                0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    char msg[96];
+    snprintf(msg, sizeof(msg), "MovieCamera: %zu settings profiles loaded\n", g_profiles.size());
+    XPLMDebugString(msg);
+}
+
+/**
+ * Switch to a profile: apply its values in memory and refresh what depends on them
+ */
+static void ApplyProfile(int index) {
+    if (index < 0 || index >= static_cast<int>(g_profiles.size())) return;
+    const SettingsProfile& profile = g_profiles[index];
+    for (const auto& entry : profile.values) {
+        ParseSettingValue(*entry.first, entry.second.c_str());
     }
+    NormalizeSettings();
+    g_activeProfile = index;
     
-    int newIndex = -1;
-    if (g_debugShotIndex >= 0 && g_debugShotIndex < static_cast<int>(shotList->size())) {
-        newIndex = g_debugShotIndex;
-    } else {
-        do {
-            newIndex = std::rand() % static_cast<int>(shotList->size());
-        } while (newIndex == g_currentShotIndex && shotList->size() > 1);
+    // Dimension sources and manual sizes may have changed
+    if (g_spectator.slot <= 0) {
+        ReadAircraftDimensions();
+    }
+    GenerateDynamicCameraShots();
+    if (g_functionActive) {
+        ApplyCameraEffectSettings();
+        
+        // The base FOV is otherwise only picked up at the next cut
+        g_lockedFov = g_baseFov;
+        SetFovImmediate(g_enableFovEffect ? g_lockedFov : g_originalFov);
     }
     
-    g_currentShotIndex = newIndex;
-    
-    // Get the shot and randomize duration
-    CameraShot shot = (*shotList)[newIndex];
-    shot.duration = g_shotMinDuration + (static_cast<float>(std::rand()) / RAND_MAX) * (g_shotMaxDuration - g_shotMinDuration);
-    
-    // Store current shot for drift calculation
-    g_currentShot = shot;
-    g_shotElapsedTime = 0.0f;
-    g_lockedFov = g_baseFov;
-    
-    return shot;
+    char msg[160];
+    snprintf(msg, sizeof(msg), "MovieCamera: Profile '%s' applied\n", profile.name.c_str());
+    XPLMDebugString(msg);
 }
 
 /**
- * Check if auto-activation conditions are met
+ * Profile commands (refcon: slot index, or -1 next / -2 previous)
  */
-static bool CheckAutoConditions() {
-    if (!g_drOnGround || !g_drGroundSpeed || !g_drElevationM) {
-        return false;
+static int ProfileCommandHandler(XPLMCommandRef inCommand, XPLMCommandPhase inPhase, void* inRefcon) {
+    (void)inCommand;
+    if (inPhase != xplm_CommandBegin || g_profiles.empty()) return 0;
+    
+    int count = static_cast<int>(g_profiles.size());
+    int action = static_cast<int>(reinterpret_cast<intptr_t>(inRefcon));
+    if (action == -1) {
+        ApplyProfile((g_activeProfile + 1) % count);
+    } else if (action == -2) {
+        ApplyProfile(g_activeProfile <= 0 ? count - 1 : g_activeProfile - 1);
+    } else {
+        ApplyProfile(action);
     }
-    
-    int onGround = XPLMGetDatai(g_drOnGround);
-    float groundSpeed = XPLMGetDataf(g_drGroundSpeed);  // m/s
-    float elevationMeters = XPLMGetDataf(g_drElevationM);
-    
-    // Convert elevation from meters to feet for comparison with g_autoAltFt
-    float altitudeFt = elevationMeters * 3.28084f;
-    
-    // Condition 1: On ground and stationary (speed < 1 m/s)
-    if (onGround && groundSpeed < 1.0f) {
-        return true;
+    return 0;
+}
+
+static void RegisterProfileCommands() {
+    g_cmdProfileNext = XPLMCreateCommand("MovieCamera/profile/next", "MovieCamera: next settings profile");
+    g_cmdProfilePrevious = XPLMCreateCommand("MovieCamera/profile/previous", "MovieCamera: previous settings profile");
+    XPLMRegisterCommandHandler(g_cmdProfileNext, ProfileCommandHandler, 1, reinterpret_cast<void*>(static_cast<intptr_t>(-1)));
+    XPLMRegisterCommandHandler(g_cmdProfilePrevious, ProfileCommandHandler, 1, reinterpret_cast<void*>(static_cast<intptr_t>(-2)));
+    for (int i = 0; i < PROFILE_COMMAND_SLOTS; i++) {
+        char name[64];
+        char description[64];
+        snprintf(name, sizeof(name), "MovieCamera/profile/%d", i + 1);
+        snprintf(description, sizeof(description), "MovieCamera: settings profile %d", i + 1);
+        g_cmdProfileSlots[i] = XPLMCreateCommand(name, description);
+        XPLMRegisterCommandHandler(g_cmdProfileSlots[i], ProfileCommandHandler, 1, reinterpret_cast<void*>(static_cast<intptr_t>(i)));
     }
-    
-    // Condition 2: In the air above Auto Alt and mouse idle for Delay time
-    if (!onGround && altitudeFt > g_autoAltFt && g_mouseIdleTime >= g_delaySeconds) {
-        return true;
+}
+
+static void UnregisterProfileCommands() {
+    if (g_cmdProfileNext) {
+        XPLMUnregisterCommandHandler(g_cmdProfileNext, ProfileCommandHandler, 1, reinterpret_cast<void*>(static_cast<intptr_t>(-1)));
+        XPLMUnregisterCommandHandler(g_cmdProfilePrevious, ProfileCommandHandler, 1, reinterpret_cast<void*>(static_cast<intptr_t>(-2)));
+    }
+    for (int i = 0; i < PROFILE_COMMAND_SLOTS; i++) {
+        if (g_cmdProfileSlots[i]) {
+            XPLMUnregisterCommandHandler(g_cmdProfileSlots[i], ProfileCommandHandler, 1, reinterpret_cast<void*>(static_cast<intptr_t>(i)));
+        }
     }
-    
-    return false;
 }
 
 /**
- * Start camera control
+ * Start analysing the configured audio file on a worker thread
+ * Any previous analysis is cancelled first
  */
-static void StartCameraControl() {
+static void StartBeatAnalysis() {
+    StopBeatAnalysis();
+    if (g_beatAudioPath[0] == '\0') {
+        g_beatMessage = "no audio file set";
+        g_beatState.store(BeatAnalysisState::Failed, std::memory_order_release);
+        return;
+    }
+    
+    std::string path = g_beatAudioPath;
+    g_beatCancel.store(false);
+    g_beatState.store(BeatAnalysisState::Running, std::memory_order_release);
+    g_beatWorker = std::thread([path]() {
+        BeatTimeline timeline;
+        std::string message;
+        bool ok = AnalyzeBeats(path, g_beatCancel, timeline, message);
+        g_beatTimeline = std::move(timeline);
+        g_beatMessage = message;
+        g_beatState.store(ok ? BeatAnalysisState::Ready : BeatAnalysisState::Failed, std::memory_order_release);
+    });
+    
+    XPLMDebugString("MovieCamera: Beat analysis started\n");
+}
+
+/**
+ * Cancel and join the beat analysis worker, if any
+ */
+static void StopBeatAnalysis() {
+    if (g_beatWorker.joinable()) {
+        g_beatCancel.store(true);
+        g_beatWorker.join();
+    }
+}
+
+/**
+ * Extract the user aircraft's cockpit points of interest on a worker thread
+ * Unless a traffic target is spectated, the worker also builds a shot table
+ * aimed at them and publishes it ahead of the POIs; the flight loop adopts it.
+ */
+static void StartCockpitPoiExtraction() {
+    StopCockpitPoiExtraction();
+    ResetAircraftData();
+    
+    char fileName[256] = "";
+    char acfPath[512] = "";
+    XPLMGetNthAircraftModel(0, fileName, acfPath);
+    if (acfPath[0] == '\0') return;
+    
+    std::string path = acfPath;
+    std::string cachePath = GetPluginPath() + "cockpit_poi.cache";
+    bool buildShots = g_spectator.slot <= 0;
+    ShotBuildInput shotInput = buildShots ? SnapshotShotBuildInput() : ShotBuildInput();
+    g_poiCancel.store(false);
+    g_poiWorker = std::thread([path, cachePath, buildShots, shotInput]() mutable {
+        CockpitPois pois;
+        std::string message;
+        bool ok = ExtractCockpitPois(path, cachePath, g_poiCancel, pois, message);
+        AircraftData& data = g_aircraftData;
+        if (ok) {
+            data.pois = ArenaNew<CockpitPois>(data.arena);
+            *data.pois = pois;
+            if (buildShots) {
+                shotInput.pois = pois;
+                shotInput.aimAtPois = true;
+                PublishShotTable(BuildShotTable(shotInput));
+            }
+        }
+        data.poiMessage = ArenaCopyString(data.arena, message);
+        g_aircraftPublished.store(&data, std::memory_order_release);
+    });
+}
+
+/**
+ * Unpublish the aircraft data and free all of it at once
+ * The worker must not be running.
+ */
+static void ResetAircraftData() {
+    g_aircraftPublished.store(nullptr, std::memory_order_release);
+    g_aircraftData.pois = nullptr;
+    g_aircraftData.poiMessage = "";
+    ResetArena(g_aircraftData.arena);
+    g_poiApplied = false;
+}
+
+/**
+ * Cockpit points of interest of the user aircraft, or null until they are ready
+ */
+static const CockpitPois* PublishedPois() {
+    const AircraftData* data = g_aircraftPublished.load(std::memory_order_acquire);
+    return data ? data->pois : nullptr;
+}
+
+/**
+ * Cancel and join the cockpit POI worker, if any
+ */
+static void StopCockpitPoiExtraction() {
+    if (g_poiWorker.joinable()) {
+        g_poiCancel.store(true);
+        g_poiWorker.join();
+    }
+}
+
+/**
+ * Bias a shot duration so the cut that ends it lands on a beat
+ * The beat is searched within the configured duration range, so pacing stays
+ * inside the user's limits; without a beat timeline the duration is unchanged
+ * @param duration - Randomised shot duration (seconds)
+ * @param leadIn - Time before the shot's countdown starts (e.g. transition length)
+ * @return Adjusted duration
+ */
+static float AlignShotDurationToBeat(float duration, float leadIn) {
+    if (!g_enableBeatSync || g_beatState.load(std::memory_order_acquire) != BeatAnalysisState::Ready) {
+        return duration;
+    }
+    
+    float shotStart = g_musicClock + g_beatOffset + leadIn;
+    float beatTime;
+    if (!FindNearestBeat(g_beatTimeline, shotStart + g_shotMinDuration, shotStart + g_shotMaxDuration,
+                         shotStart + duration, beatTime)) {
+        return duration;
+    }
+    return beatTime - shotStart;
+}
+
+/**
+ * Precompute orbit state for the selected orbit shot
+ * Chooses the orbit direction so the camera swings towards the sun bearing,
+ * keeping the sun behind the camera for a front-lit aircraft. If the sun is
+ * more than ORBIT_MAX_SUN_OFFSET_DEG away, the start azimuth is pulled in so
+ * the shot opens side-lit rather than straight into the sun.
+ */
+static void PlanOrbit(const CameraShot& shot) {
+    float el = shot.orbitElevation * PI / 180.0f;
+    float startAz = shot.orbitStartAzimuth;
+    float rate = shot.orbitRate;
+    
+    if (g_drSunPitch && g_drSunHeading &&
+        XPLMGetDataf(g_drSunPitch) > ORBIT_MIN_SUN_PITCH_DEG) {
+        // Camera bearing from the target (world) should approach the sun heading
+        SubjectPose subject;
+        ReadSubjectPose(subject);
+        float startBearing = subject.heading + startAz;
+        float sunOffset = NormalizeAngle(XPLMGetDataf(g_drSunHeading) - startBearing);
+        float direction = (sunOffset >= 0.0f) ? 1.0f : -1.0f;
+        rate = direction * std::abs(rate);
+        
+        if (std::abs(sunOffset) > ORBIT_MAX_SUN_OFFSET_DEG) {
+            startAz += sunOffset - direction * ORBIT_MAX_SUN_OFFSET_DEG;
+        }
+    }
+    
+    g_orbit.startAzimuth = startAz * PI / 180.0f;
+    g_orbit.angularRate = rate * PI / 180.0f;
+    g_orbit.horizontalRadius = shot.orbitRadius * std::cos(el);
+    g_orbit.verticalOffset = shot.orbitRadius * std::sin(el);
+    g_orbit.elevationDeg = shot.orbitElevation;
+}
+
+/**
+ * Sample the watched cockpit controls and raise or expire instrument cues
+ * A fresh cue ends the current shot early once it has run for a moment, so
+ * the cut follows the change; otherwise the next regular cut takes it.
+ */
+static void UpdateInstrumentCues(float deltaTime) {
+    InstrumentCueState& cue = g_instrumentCue;
+    cue.cooldown = std::max(cue.cooldown - deltaTime, 0.0f);
+    if (cue.group >= 0) {
+        cue.age += deltaTime;
+        if (cue.age > INSTRUMENT_CUE_LIFETIME) cue.group = -1;
+    }
+    
+    cue.sampleTimer += deltaTime;
+    if (cue.sampleTimer >= INSTRUMENT_SAMPLE_INTERVAL) {
+        cue.sampleTimer = 0.0f;
+        unsigned changed = SampleInstruments();
+        // The user aircraft's controls mean nothing while the camera is on traffic
+        if (changed && g_enableInstrumentCues && g_spectator.slot <= 0 && cue.cooldown <= 0.0f) {
+            for (int g = 0; g < static_cast<int>(InstrumentGroup::Count); g++) {
+                if (!(changed & (1u << g))) continue;
+                cue.group = g;
+                cue.age = 0.0f;
+                cue.cooldown = INSTRUMENT_CUT_COOLDOWN;
+                char msg[96];
+                snprintf(msg, sizeof(msg), "MovieCamera: Instrument cue -> %s\n", g_instrumentShots[g].shotName);
+                XPLMDebugString(msg);
+                break;
+            }
+        }
+    }
+    
+    if (cue.group >= 0 && g_functionActive && !g_functionPaused && !g_inTransition &&
+        g_shotElapsedTime >= INSTRUMENT_MIN_SHOT_TIME && g_currentShotTime > 0.0f) {
+        g_currentShotTime = 0.0f;
+    }
+}
+
+/**
+ * Consume the pending instrument cue
+ * @return The cued group's shot, or nullptr if there is none (or cues are unusable right now)
+ */
+static const InstrumentShot* TakeInstrumentCue() {
+    int group = g_instrumentCue.group;
+    g_instrumentCue.group = -1;
+    if (group < 0 || g_spectator.slot > 0 || g_debugShotType == DebugShotType::External) return nullptr;
+    return &g_instrumentShots[group];
+}
+
+/**
+ * Select the next camera shot
+ */
+static CameraShot SelectNextShot() {
+    const ShotTable& table = *g_shotTable;
+    const ShotList* shotList = nullptr;
+    bool canSwitchType = g_consecutiveSameTypeCount >= 3;
+    const InstrumentShot* cue = TakeInstrumentCue();
+    int cueIndex = -1;
+    if (cue) {
+        for (int i = 0; i < static_cast<int>(table.cockpit.size()) && cueIndex < 0; i++) {
+            if (table.cockpit[i].name == cue->shotName) cueIndex = i;
+        }
+    }
+    
+    // Determine which shot type to use
+    CameraType nextType;
+    if (g_spectator.slot > 0) {
+        // We know nothing about a traffic target's cockpit - exterior shots only
+        nextType = CameraType::External;
+    } else if (g_debugShotType == DebugShotType::Cockpit) {
+        nextType = CameraType::Cockpit;
+    } else if (g_debugShotType == DebugShotType::External) {
+        nextType = CameraType::External;
+    } else if (cueIndex >= 0) {
+        // A control just changed - show it
+        nextType = CameraType::Cockpit;
+    } else if (canSwitchType) {
+        // Can switch types - the flight phase decides how likely the cockpit is
+        float cockpitChance = g_phasePolicies[static_cast<int>(g_flightPhase.phase)].cockpitChance;
+        nextType = (static_cast<float>(std::rand()) / RAND_MAX < cockpitChance) ? CameraType::Cockpit : CameraType::External;
+    } else {
+        // Must continue with same type
+        nextType = g_lastShotType;
+    }
+    
+    // Select the appropriate shot list
+    const ShotColumns* columns;
+    if (nextType == CameraType::Cockpit) {
+        shotList = &table.cockpit;
+        columns = &table.cockpitColumns;
+    } else {
+        shotList = &table.external;
+        columns = &table.externalColumns;
+    }
+    // An index into an older table says nothing about this one
+    int previousIndex = (g_currentShotTable == g_shotTable) ? g_currentShotIndex : -1;
+    
+    // Update tracking
+    if (nextType != g_lastShotType) {
+        g_consecutiveSameTypeCount = 1;
+        g_lastShotType = nextType;
+    } else {
+        g_consecutiveSameTypeCount++;
+    }
+    
+    // Select a random shot from the list (avoid same shot twice)
+    if (shotList->empty()) {
+        // Fallback - include drift values
+        return {CameraType::Cockpit, 0, 0, 0, 0, 0, 0, 1.0f, 4.0f, "Default",
+                0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    }
+    
+    int newIndex = -1;
+    if (g_debugShotIndex >= 0 && g_debugShotIndex < static_cast<int>(shotList->size())) {
+        newIndex = g_debugShotIndex;
+    } else if (nextType == CameraType::Cockpit && cueIndex >= 0) {
+        newIndex = cueIndex;
+    } else {
+        // Restrict the pick to the shot family of the current flight phase
+        if (g_shotCandidates.size() < shotList->size()) {
+            g_shotCandidates.resize(shotList->size());
+        }
+        int* candidates = g_shotCandidates.data();
+        int candidateCount = GatherPhaseCandidates(*columns, PhaseBit(g_flightPhase.phase),
+                                                   shotList->size() == 1 ? -1 : previousIndex, candidates);
+        if (candidateCount > 0) {
+            // Exterior candidates are weighted by how well their opening frame composes the subject
+            float* weights = nullptr;
+            if (nextType == CameraType::External) {
+                if (g_shotWeights.size() < g_shotCandidates.size()) {
+                    g_shotWeights.resize(g_shotCandidates.size());
+                }
+                weights = g_shotWeights.data();
+                WeighCandidateCompositions(*shotList, *columns, candidates, candidateCount, weights);
+            }
+            // Draw without replacement until a shot has a clear line of sight past traffic
+            do {
+                int pick = weights ? DrawWeightedCandidate(weights, candidateCount) : std::rand() % candidateCount;
+                newIndex = candidates[pick];
+                candidates[pick] = candidates[--candidateCount];
+                if (weights) weights[pick] = weights[candidateCount];
+            } while (candidateCount > 0 && IsShotBlockedByTraffic((*shotList)[newIndex]));
+        } else {
+            do {
+                newIndex = std::rand() % static_cast<int>(shotList->size());
+            } while (newIndex == previousIndex && shotList->size() > 1);
+        }
+    }
+    
+    g_currentShotIndex = newIndex;
+    g_currentShotTable = g_shotTable;
+    
+    // Get the shot and randomize duration, paced by the flight phase
+    // With traffic close by, an exterior shot may become a two-shot instead,
+    // and with a landmark on the path, a landmark shot
+    CameraShot shot = (*shotList)[newIndex];
+    if (nextType == CameraType::Cockpit && newIndex == cueIndex) {
+        if (const CockpitPois* pois = PublishedPois()) {
+            AimShotAtPoi(shot, cue->poi, *pois, g_aircraftDims);
+        }
+    }
+    if (nextType == CameraType::External && g_debugShotIndex < 0 &&
+        static_cast<float>(std::rand()) / RAND_MAX < TWO_SHOT_CHANCE && PlanTwoShot()) {
+        shot = {CameraType::External, 0, 0, 0, 0, 0, 0, 1.0f, 0.0f, "Two-Shot",
+                0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        shot.motion = ShotMotion::TwoShot;
+    } else if (nextType == CameraType::External && g_debugShotIndex < 0 &&
+               static_cast<float>(std::rand()) / RAND_MAX < LANDMARK_SHOT_CHANCE && PlanLandmarkShot()) {
+        shot = {CameraType::External, 0, 0, 0, 0, 0, 0, 1.0f, 0.0f, "Landmark",
+                0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        shot.motion = ShotMotion::Landmark;
+    }
+    shot.duration = g_shotMinDuration + (static_cast<float>(std::rand()) / RAND_MAX) * (g_shotMaxDuration - g_shotMinDuration);
+    shot.duration = std::clamp(shot.duration * g_phasePolicies[static_cast<int>(g_flightPhase.phase)].durationScale, 1.0f, 30.0f);
+    
+    // Store current shot for drift calculation
+    g_currentShot = shot;
+    g_currentShotEvaluator = ChooseShotEvaluator(shot);
+    g_shotElapsedTime = 0.0f;
+    g_composition.poorTime = 0.0f;
+    if (shot.motion == ShotMotion::Orbit) {
+        PlanOrbit(shot);
+    } else if (shot.motion == ShotMotion::Wingman) {
+        PlanWingman(shot);
+    }
+    g_lockedFov = g_baseFov;
+    
+    return shot;
+}
+
+/**
+ * Classify the next flight phase from one sample
+ * Each phase only looks at the exits that make sense from it, with separate
+ * enter/exit thresholds so values hovering around a limit don't flip-flop
+ * @param levelSeconds - How long the vertical speed has stayed within PHASE_LEVEL_FPM
+ */
+static FlightPhase ClassifyFlightPhase(FlightPhase current, bool onGround, float groundSpeedKt,
+                                       float verticalSpeedFpm, float aglFt, float levelSeconds) {
+    switch (current) {
+        case FlightPhase::Parked:
+            if (!onGround) return FlightPhase::InitialClimb;
+            if (groundSpeedKt > PHASE_TAXI_ENTER_KT) return FlightPhase::Taxi;
+            return current;
+        case FlightPhase::Taxi:
+            if (!onGround) return FlightPhase::InitialClimb;
+            if (groundSpeedKt > PHASE_ROLL_ENTER_KT) return FlightPhase::TakeoffRoll;
+            if (groundSpeedKt < PHASE_TAXI_EXIT_KT) return FlightPhase::Parked;
+            return current;
+        case FlightPhase::TakeoffRoll:
+            if (!onGround) return FlightPhase::InitialClimb;
+            if (groundSpeedKt < PHASE_ROLL_EXIT_KT) return FlightPhase::Taxi;
+            return current;
+        case FlightPhase::InitialClimb:
+            if (onGround) return FlightPhase::LandingRoll;
+            if (aglFt > PHASE_CLIMB_EXIT_AGL_FT) return FlightPhase::Cruise;
+            // Low-level flights never climb through the threshold: level off or descend instead
+            if (levelSeconds >= PHASE_LEVEL_SECONDS) return FlightPhase::Cruise;
+            if (verticalSpeedFpm < PHASE_DESCENT_ENTER_FPM) {
+                return aglFt < PHASE_APPROACH_ENTER_AGL_FT ? FlightPhase::Approach : FlightPhase::Descent;
+            }
+            return current;
+        case FlightPhase::Cruise:
+            if (onGround) return FlightPhase::LandingRoll;
+            if (verticalSpeedFpm < PHASE_DESCENT_ENTER_FPM) {
+                return aglFt < PHASE_APPROACH_ENTER_AGL_FT ? FlightPhase::Approach : FlightPhase::Descent;
+            }
+            return current;
+        case FlightPhase::Descent:
+            if (onGround) return FlightPhase::LandingRoll;
+            if (aglFt < PHASE_APPROACH_ENTER_AGL_FT) return FlightPhase::Approach;
+            if (verticalSpeedFpm > PHASE_DESCENT_EXIT_FPM) return FlightPhase::Cruise;
+            return current;
+        case FlightPhase::Approach:
+            if (onGround) return FlightPhase::LandingRoll;
+            if (verticalSpeedFpm > PHASE_GO_AROUND_FPM) return FlightPhase::InitialClimb;
+            if (aglFt > PHASE_APPROACH_EXIT_AGL_FT) return FlightPhase::Descent;
+            return current;
+        case FlightPhase::LandingRoll:
+            if (!onGround) return FlightPhase::InitialClimb;
+            if (groundSpeedKt < PHASE_ROLL_EXIT_KT) return FlightPhase::Taxi;
+            return current;
+        default:
+            return FlightPhase::Parked;
+    }
+}
+
+/**
+ * Step the classifier from Parked until it settles on a phase
+ * Lets a state first seen in flight start in its real phase rather than
+ * walking there through confirmations.
+ */
+static FlightPhase SettleFlightPhase(bool onGround, float groundSpeedKt, float verticalSpeedFpm,
+                                     float aglFt, float levelSeconds) {
+    FlightPhase phase = FlightPhase::Parked;
+    for (int i = 0; i < static_cast<int>(FlightPhase::Count); i++) {
+        FlightPhase next = ClassifyFlightPhase(phase, onGround, groundSpeedKt, verticalSpeedFpm, aglFt, levelSeconds);
+        if (next == phase) break;
+        phase = next;
+    }
+    return phase;
+}
+
+/**
+ * Accept a classifier result only once PHASE_CONFIRM_SAMPLES consecutive samples agree
+ * @return true if phase changed to next
+ */
+static bool ConfirmFlightPhase(FlightPhase& phase, FlightPhase& candidate, int& candidateSamples, FlightPhase next) {
+    if (next == phase) {
+        candidate = next;
+        candidateSamples = 0;
+        return false;
+    }
+    if (next == candidate) {
+        candidateSamples++;
+    } else {
+        candidate = next;
+        candidateSamples = 1;
+    }
+    if (candidateSamples < PHASE_CONFIRM_SAMPLES) return false;
+    phase = next;
+    candidateSamples = 0;
+    return true;
+}
+
+/**
+ * Read one sample of the user aircraft's flight state into g_flightPhase
+ * @param elapsed - Time since the previous sample (for the level-flight timer)
+ */
+static void SampleFlightPhaseInputs(float elapsed) {
+    g_flightPhase.onGround = g_drOnGround ? XPLMGetDatai(g_drOnGround) != 0 : true;
+    g_flightPhase.groundSpeedKt = g_drGroundSpeed ? XPLMGetDataf(g_drGroundSpeed) * MPS_TO_KT : 0.0f;
+    g_flightPhase.verticalSpeedFpm = g_drVerticalSpeed ? XPLMGetDataf(g_drVerticalSpeed) : 0.0f;
+    g_flightPhase.aglFt = g_drTerrainY ? XPLMGetDataf(g_drTerrainY) * M_TO_FT : 0.0f;
+    if (std::abs(g_flightPhase.verticalSpeedFpm) < PHASE_LEVEL_FPM) {
+        g_flightPhase.levelSeconds += elapsed;
+    } else {
+        g_flightPhase.levelSeconds = 0.0f;
+    }
+}
+
+/**
+ * Set the phase straight from the live state, without confirmation
+ * Used on enable and aircraft load, so a plugin started in flight does not spend
+ * the confirmation delay in Parked. The classifier is stepped from Parked until
+ * it settles; level flight counts as already sustained.
+ */
+static void SeedFlightPhase() {
+    SampleFlightPhaseInputs(0.0f);
+    if (std::abs(g_flightPhase.verticalSpeedFpm) < PHASE_LEVEL_FPM) {
+        g_flightPhase.levelSeconds = PHASE_LEVEL_SECONDS;
+    }
+    FlightPhase phase = SettleFlightPhase(g_flightPhase.onGround, g_flightPhase.groundSpeedKt,
+                                          g_flightPhase.verticalSpeedFpm, g_flightPhase.aglFt,
+                                          g_flightPhase.levelSeconds);
+    g_flightPhase.phase = phase;
+    g_flightPhase.candidate = phase;
+    g_flightPhase.candidateSamples = 0;
+    g_flightPhase.sampleTimer = 0.0f;
+    
+    char msg[96];
+    snprintf(msg, sizeof(msg), "MovieCamera: Flight phase seeded as %s\n", g_phasePolicies[static_cast<int>(phase)].name);
+    XPLMDebugString(msg);
+}
+
+/**
+ * Sample the flight state at low rate and advance the flight phase
+ * A new phase is only accepted after PHASE_CONFIRM_SAMPLES agreeing samples
+ */
+static void UpdateFlightPhase(float deltaTime) {
+    g_flightPhase.sampleTimer += deltaTime;
+    if (g_flightPhase.sampleTimer < PHASE_SAMPLE_INTERVAL) return;
+    float elapsed = g_flightPhase.sampleTimer;
+    g_flightPhase.sampleTimer = 0.0f;
+    SampleFlightPhaseInputs(elapsed);
+    
+    FlightPhase next = ClassifyFlightPhase(g_flightPhase.phase, g_flightPhase.onGround, g_flightPhase.groundSpeedKt,
+                                           g_flightPhase.verticalSpeedFpm, g_flightPhase.aglFt,
+                                           g_flightPhase.levelSeconds);
+    FlightPhase previous = g_flightPhase.phase;
+    if (ConfirmFlightPhase(g_flightPhase.phase, g_flightPhase.candidate, g_flightPhase.candidateSamples, next)) {
+        char msg[128];
+        snprintf(msg, sizeof(msg), "MovieCamera: Flight phase %s -> %s\n",
+                 g_phasePolicies[static_cast<int>(previous)].name,
+                 g_phasePolicies[static_cast<int>(next)].name);
+        XPLMDebugString(msg);
+    }
+}
+
+/**
+ * Check if auto-activation conditions are met for the current flight phase
+ */
+static bool CheckAutoConditions() {
+    switch (g_phasePolicies[static_cast<int>(g_flightPhase.phase)].autoActivation) {
+        case AutoActivation::Always:
+            return true;
+        case AutoActivation::WhenIdleAboveAutoAlt: {
+            if (!g_drElevationM) return false;
+            // Convert elevation from meters to feet for comparison with g_autoAltFt
+            float altitudeFt = XPLMGetDataf(g_drElevationM) * M_TO_FT;
+            return altitudeFt > g_autoAltFt && g_mouseIdleTime >= g_delaySeconds;
+        }
+        case AutoActivation::Never:
+        default:
+            return false;
+    }
+}
+
+/**
+ * Push the handheld and G-force settings to X-Plane's camera effects
+ */
+static void ApplyCameraEffectSettings() {
+    // Handheld shake only when enabled; otherwise the user's own setting is put back
+    if (g_enableHandheldEffect && g_drHandheldCam) {
+        XPLMSetDataf(g_drHandheldCam, g_handheldIntensity);
+    } else if (g_drHandheldCam) {
+        XPLMSetDataf(g_drHandheldCam, g_originalHandheldCam);
+    }
+    
+    if (g_enableGForceEffect && g_drGloadedCam) {
+        XPLMSetDataf(g_drGloadedCam, 1.0f);
+    } else if (g_drGloadedCam) {
+        XPLMSetDataf(g_drGloadedCam, 0.0f);
+    }
+}
+
+/**
+ * Start camera control
+ */
+static void StartCameraControl() {
     if (g_functionActive) return;
     
     g_functionActive = true;
@@ -1621,6 +3640,7 @@ static void StartCameraControl() {
     g_currentShotIndex = -1;
     g_consecutiveSameTypeCount = 0;
     g_inTransition = false;
+    g_spectator.cutPending = false;
     
     // Start with a random shot type
     g_lastShotType = (std::rand() % 2 == 0) ? CameraType::Cockpit : CameraType::External;
@@ -1628,110 +3648,1625 @@ static void StartCameraControl() {
     // Select the first shot (this also sets g_currentShot)
     CameraShot firstShot = SelectNextShot();
     
-    // Read current camera position for smooth start
-    XPLMReadCameraPosition(&g_startPos);
-    
-    // Calculate target position (starting position of the shot)
-    float acfX = XPLMGetDataf(g_drLocalX);
-    float acfY = XPLMGetDataf(g_drLocalY);
-    float acfZ = XPLMGetDataf(g_drLocalZ);
-    float acfHeading = XPLMGetDataf(g_drHeading);
-    
-    float rad = acfHeading * PI / 180.0f;
-    float cosH = std::cos(rad);
-    float sinH = std::sin(rad);
-    
-    // For cockpit shots, add pilot eye position as base offset
-    float shotX = firstShot.x;
-    float shotY = firstShot.y;
-    float shotZ = firstShot.z;
-    if (firstShot.type == CameraType::Cockpit) {
-        shotX += g_aircraftDims.pilotEyeX;
-        shotY += g_aircraftDims.pilotEyeY;
-        shotZ += g_aircraftDims.pilotEyeZ;
-    }
-    
-    g_targetPos.x = acfX + shotX * cosH - shotZ * sinH;
-    g_targetPos.y = acfY + shotY;
-    g_targetPos.z = acfZ + shotX * sinH + shotZ * cosH;
-    g_targetPos.pitch = firstShot.pitch;
-    g_targetPos.heading = acfHeading + firstShot.heading;
-    g_targetPos.roll = firstShot.roll;
-    g_targetPos.zoom = firstShot.zoom;
-    
-    // Instant camera switch - no smooth transition
+    // First shot starts instantly - there is no outgoing shot to transition from
     g_inTransition = false;
     g_transitionProgress = 0.0f;
-    g_currentShotTime = firstShot.duration;
+    g_musicClock = 0.0f;
+    g_currentShot.duration = AlignShotDurationToBeat(firstShot.duration, 0.0f);
+    g_currentShotTime = g_currentShot.duration;
+    
+    // Save current camera effect state before taking control
+    SaveCameraEffectState();
+    if (g_enableFovEffect) {
+        SetFovImmediate(g_lockedFov);
+    }
+    
+    ApplyCameraEffectSettings();
+    
+    // Take camera control
+    XPLMControlCamera(xplm_ControlCameraForever, CameraControlCallback, nullptr);
+    
+    XPLMDebugString("MovieCamera: Camera control started\n");
+}
+
+/**
+ * Stop camera control
+ */
+static void StopCameraControl() {
+    if (!g_functionActive) return;
+    
+    g_functionActive = false;
+    g_functionPaused = false;
+    
+    // Release camera control
+    XPLMDontControlCamera();
+    
+    // Restore original camera effect state
+    RestoreCameraEffectState();
+    
+    XPLMDebugString("MovieCamera: Camera control stopped\n");
+}
+
+/**
+ * Pause camera control (on mouse movement)
+ */
+static void PauseCameraControl() {
+    if (!g_functionActive || g_functionPaused) return;
+    
+    g_functionPaused = true;
+    
+    // Release camera to return to default view
+    XPLMDontControlCamera();
+    
+    XPLMDebugString("MovieCamera: Camera control paused\n");
+}
+
+/**
+ * Resume camera control after pause
+ */
+static void ResumeCameraControl() {
+    if (!g_functionActive || !g_functionPaused) return;
+    
+    g_functionPaused = false;
+    
+    // Blend out of the view the user left us in, then retake camera control
+    SnapHeadAnchor();
+    BeginResumeTransition();
+    XPLMControlCamera(xplm_ControlCameraForever, CameraControlCallback, nullptr);
+    
+    XPLMDebugString("MovieCamera: Camera control resumed\n");
+}
+
+/**
+ * Read the pose of the camera subject
+ * In spectator mode this is the target's entry in this frame's traffic snapshot
+ */
+static void ReadSubjectPose(SubjectPose& out) {
+    int slot = g_spectator.slot;
+    if (slot > 0 && slot < g_traffic.count) {
+        out.x = g_traffic.x[slot];
+        out.y = g_traffic.y[slot];
+        out.z = g_traffic.z[slot];
+        out.heading = g_traffic.heading[slot];
+        out.pitch = g_traffic.pitch[slot];
+        out.roll = g_traffic.roll[slot];
+        return;
+    }
+    
+    out.x = XPLMGetDataf(g_drLocalX);
+    out.y = XPLMGetDataf(g_drLocalY);
+    out.z = XPLMGetDataf(g_drLocalZ);
+    out.heading = XPLMGetDataf(g_drHeading);
+    out.pitch = XPLMGetDataf(g_drPitch);
+    out.roll = XPLMGetDataf(g_drRoll);
+}
+
+/**
+ * Terrain height under a point, or just below the point if the probe misses
+ */
+static float ProbeTerrainY(float x, float y, float z) {
+    if (g_terrainProbe) {
+        XPLMProbeInfo_t probe;
+        probe.structSize = sizeof(XPLMProbeInfo_t);
+        if (XPLMProbeTerrainXYZ(g_terrainProbe, x, y, z, &probe) == xplm_ProbeHitTerrain) {
+            return probe.locationY;
+        }
+    }
+    return y - MIN_CAMERA_HEIGHT_ABOVE_GROUND;
+}
+
+/**
+ * Estimate a traffic aircraft's dimensions from its ICAO type
+ */
+static void EstimateTypeDimensions(const char* icaoType, AircraftDimensions& outDims, bool& outHeavy) {
+    outDims.setDefaults();
+    outHeavy = false;
+    for (const TypeClassDims& entry : g_typeClassDims) {
+        if (std::strncmp(icaoType, entry.prefix, std::strlen(entry.prefix)) == 0) {
+            outDims.wingspan = entry.wingspan;
+            outDims.fuselageLength = entry.fuselageLength;
+            outDims.height = entry.height;
+            outHeavy = entry.heavy;
+            return;
+        }
+    }
+}
+
+/**
+ * Overwrite estimated dimensions with whatever an AI model's .acf provides
+ * Same precedence as ReadAircraftDimensions in Auto mode.
+ */
+static void ApplyModelDimensions(const ModelDimensions& model, AircraftDimensions& dims) {
+    if (model.sizeX > MIN_WINGSPAN) dims.wingspan = model.sizeX;
+    float semilenSpan = model.maxSemilen * 2.0f;
+    if (semilenSpan > dims.wingspan && semilenSpan < dims.wingspan * 1.5f) {
+        dims.wingspan = semilenSpan;
+    } else if (model.sizeX <= MIN_WINGSPAN && semilenSpan > MIN_WINGSPAN) {
+        dims.wingspan = semilenSpan;
+    }
+    if (model.sizeZ > MIN_FUSELAGE_LENGTH) dims.fuselageLength = model.sizeZ;
+    if (model.pilotEyeY > 0.0f) {
+        dims.pilotEyeY = model.pilotEyeY;
+        dims.height = model.pilotEyeY * PILOT_Y_TO_HEIGHT_MULTIPLIER + ESTIMATED_GROUND_CLEARANCE;
+    }
+    dims.wingspan = std::clamp(dims.wingspan, MIN_WINGSPAN, MAX_WINGSPAN);
+    dims.fuselageLength = std::clamp(dims.fuselageLength, MIN_FUSELAGE_LENGTH, MAX_FUSELAGE_LENGTH);
+    dims.height = std::clamp(dims.height, MIN_HEIGHT, MAX_HEIGHT);
+}
+
+/**
+ * Hand an AI aircraft's model to the dimension cache
+ * XPLM calls stay on the sim thread; only the path goes to the worker.
+ */
+static void RequestAircraftModel(int index) {
+    char fileName[256] = "";
+    char path[512] = "";
+    XPLMGetNthAircraftModel(index, fileName, path);
+    RequestModelDimensions(index, path);
+}
+
+// Indexed min-heap on -score: the top entry is the most interesting target
+static bool InterestBefore(int a, int b) {
+    return g_interest[a].score > g_interest[b].score;
+}
+
+static void InterestHeapSwap(int i, int j) {
+    std::swap(g_interestHeap.entries[i], g_interestHeap.entries[j]);
+    g_interestHeap.position[g_interestHeap.entries[i]] = i;
+    g_interestHeap.position[g_interestHeap.entries[j]] = j;
+}
+
+static void InterestHeapSiftUp(int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!InterestBefore(g_interestHeap.entries[i], g_interestHeap.entries[parent])) break;
+        InterestHeapSwap(i, parent);
+        i = parent;
+    }
+}
+
+static void InterestHeapSiftDown(int i) {
+    for (;;) {
+        int best = i;
+        int left = 2 * i + 1, right = left + 1;
+        if (left < g_interestHeap.size && InterestBefore(g_interestHeap.entries[left], g_interestHeap.entries[best])) best = left;
+        if (right < g_interestHeap.size && InterestBefore(g_interestHeap.entries[right], g_interestHeap.entries[best])) best = right;
+        if (best == i) break;
+        InterestHeapSwap(i, best);
+        i = best;
+    }
+}
+
+/**
+ * Insert an entry or restore heap order after its score changed
+ */
+static void InterestHeapUpdate(int entry) {
+    int i = g_interestHeap.position[entry];
+    if (i < 0) {
+        i = g_interestHeap.size++;
+        g_interestHeap.entries[i] = entry;
+        g_interestHeap.position[entry] = i;
+    }
+    InterestHeapSiftUp(i);
+    InterestHeapSiftDown(g_interestHeap.position[entry]);
+}
+
+static void InterestHeapRemove(int entry) {
+    int i = g_interestHeap.position[entry];
+    if (i < 0) return;
+    int last = --g_interestHeap.size;
+    if (i != last) {
+        InterestHeapSwap(i, last);
+    }
+    g_interestHeap.position[entry] = -1;
+    if (i != last) {
+        InterestHeapSiftUp(i);
+        InterestHeapSiftDown(g_interestHeap.position[g_interestHeap.entries[i]]);
+    }
+}
+
+static void ResetDirector() {
+    for (int i = 0; i < TRAFFIC_MAX_TARGETS; i++) {
+        g_interest[i].modeS = 0;
+        g_interestHeap.position[i] = -1;
+    }
+    g_interestHeap.size = 0;
+}
+
+/**
+ * Find the interest entry of an airframe
+ * @param hint - Entry to try first (the TCAS slot; entries are allocated there when free)
+ * @return Entry index, or -1 if the airframe has none
+ */
+static int FindInterest(int modeS, int hint) {
+    if (modeS == 0) return -1;
+    if (hint >= 0 && hint < TRAFFIC_MAX_TARGETS && g_interest[hint].modeS == modeS) return hint;
+    for (int i = 0; i < TRAFFIC_MAX_TARGETS; i++) {
+        if (g_interest[i].modeS == modeS) return i;
+    }
+    return -1;
+}
+
+static int AddInterest(int modeS, int hint) {
+    int entry = -1;
+    if (hint >= 0 && hint < TRAFFIC_MAX_TARGETS && g_interest[hint].modeS == 0) {
+        entry = hint;
+    } else {
+        for (int i = 0; i < TRAFFIC_MAX_TARGETS && entry < 0; i++) {
+            if (g_interest[i].modeS == 0) entry = i;
+        }
+    }
+    if (entry < 0) return -1;
+    
+    TargetInterest& interest = g_interest[entry];
+    interest.modeS = modeS;
+    interest.phase = FlightPhase::Parked;
+    interest.candidate = FlightPhase::Parked;
+    interest.candidateSamples = 0;
+    interest.levelSeconds = 0.0f;
+    interest.lastClassified = -1.0f;
+    interest.terrainY = 0.0f;
+    interest.terrainProbed = -1.0f;
+    interest.score = 0.0f;
+    interest.lastSeen = g_director.clock;
+    interest.lastShown = -1.0f;
+    interest.heavy = false;
+    interest.dimsSource = DimsSource::Default;
+    interest.dims.setDefaults();
+    return entry;
+}
+
+/**
+ * Interest entry of a traffic slot, created on first use
+ * The cached dimensions are upgraded as better sources appear: the ICAO type
+ * estimate first, then the parsed model once the background cache has it.
+ * @return nullptr if the slot is empty or the table is full
+ */
+static TargetInterest* TrafficInterest(int slot) {
+    int modeS = g_traffic.modeS[slot];
+    int entry = FindInterest(modeS, slot);
+    if (entry < 0) {
+        entry = (modeS != 0) ? AddInterest(modeS, slot) : -1;
+        if (entry < 0) return nullptr;
+    }
+    TargetInterest& interest = g_interest[entry];
+    if (interest.dimsSource == DimsSource::Model) return &interest;
+    
+    // Without a TCAS override, slot N is aircraft index N and has a model
+    ModelDimensions model;
+    if (TrafficSlotsAreAircraftIndices() && GetModelDimensions(slot, model)) {
+        const char* icaoType = model.icaoType[0] != '\0' ? model.icaoType : g_traffic.icaoType[slot];
+        EstimateTypeDimensions(icaoType, interest.dims, interest.heavy);
+        ApplyModelDimensions(model, interest.dims);
+        interest.dimsSource = DimsSource::Model;
+    } else if (interest.dimsSource == DimsSource::Default && g_traffic.icaoType[slot][0] != '\0') {
+        EstimateTypeDimensions(g_traffic.icaoType[slot], interest.dims, interest.heavy);
+        interest.dimsSource = DimsSource::IcaoType;
+    }
+    return &interest;
+}
+
+/**
+ * Rescore one traffic slot
+ * Interest = what the target is doing (phase, runway, closing on the spotter,
+ * heavy type, proximity), damped while the audience has recently seen it.
+ */
+static void ScoreTrafficSlot(int slot) {
+    TargetInterest* entry = TrafficInterest(slot);
+    if (!entry) return;
+    TargetInterest& interest = *entry;
+    interest.lastSeen = g_director.clock;
+    
+    // The target's own flight phase, with the same classifier and confirmation as the user
+    // aircraft. The terrain under it is probed at a low rate; the AGL in between uses the
+    // cached height, which is plenty for the phase thresholds.
+    if (interest.terrainProbed < 0.0f || g_director.clock - interest.terrainProbed >= DIRECTOR_TERRAIN_INTERVAL) {
+        interest.terrainY = ProbeTerrainY(g_traffic.x[slot], g_traffic.y[slot], g_traffic.z[slot]);
+        interest.terrainProbed = g_director.clock;
+    }
+    bool onGround = g_traffic.onGround[slot] != 0;
+    float groundSpeedKt = std::sqrt(g_traffic.vx[slot] * g_traffic.vx[slot] + g_traffic.vz[slot] * g_traffic.vz[slot]) * MPS_TO_KT;
+    float verticalSpeedFpm = g_traffic.vy[slot] * M_TO_FT * 60.0f;
+    float aglFt = (g_traffic.y[slot] - interest.terrainY) * M_TO_FT;
+    bool level = std::abs(verticalSpeedFpm) < PHASE_LEVEL_FPM;
+    if (interest.lastClassified < 0.0f) {
+        // First sample: seed like the user aircraft, level flight counts as sustained
+        interest.levelSeconds = level ? PHASE_LEVEL_SECONDS : 0.0f;
+        interest.phase = SettleFlightPhase(onGround, groundSpeedKt, verticalSpeedFpm, aglFt, interest.levelSeconds);
+        interest.candidate = interest.phase;
+        interest.candidateSamples = 0;
+    } else {
+        interest.levelSeconds = level ? interest.levelSeconds + (g_director.clock - interest.lastClassified) : 0.0f;
+        FlightPhase next = ClassifyFlightPhase(interest.phase, onGround, groundSpeedKt, verticalSpeedFpm, aglFt,
+                                               interest.levelSeconds);
+        ConfirmFlightPhase(interest.phase, interest.candidate, interest.candidateSamples, next);
+    }
+    interest.lastClassified = g_director.clock;
+    
+    float phaseScore;
+    switch (interest.phase) {
+        case FlightPhase::TakeoffRoll:
+        case FlightPhase::LandingRoll:  phaseScore = 1.0f; break;
+        case FlightPhase::InitialClimb:
+        case FlightPhase::Approach:     phaseScore = 0.8f; break;
+        case FlightPhase::Taxi:         phaseScore = 0.3f; break;
+        case FlightPhase::Cruise:
+        case FlightPhase::Descent:      phaseScore = 0.2f; break;
+        default:                        phaseScore = 0.0f; break;
+    }
+    
+    // Lined up on a runway with other traffic, or rolling on one
+    float runwayScore = 0.0f;
+    if (interest.phase == FlightPhase::TakeoffRoll || interest.phase == FlightPhase::LandingRoll) {
+        runwayScore = 1.0f;
+    } else if (g_traffic.onGround[slot]) {
+        int neighbours[1];
+        runwayScore = QueryTrafficSameRunway(g_traffic, g_trafficGrid, slot, 1, neighbours) > 0 ? 0.5f : 0.0f;
+    }
+    
+    // Closing on the spotter (the user aircraft)
+    float rx = g_traffic.x[slot] - g_traffic.x[0];
+    float ry = g_traffic.y[slot] - g_traffic.y[0];
+    float rz = g_traffic.z[slot] - g_traffic.z[0];
+    float distance = std::max(g_traffic.distance[slot], 1.0f);
+    float closing = -(rx * g_traffic.vx[slot] + ry * g_traffic.vy[slot] + rz * g_traffic.vz[slot]) / distance;
+    float closingScore = std::clamp(closing / DIRECTOR_CLOSING_SPEED_MPS, 0.0f, 1.0f);
+    
+    float proximityScore = 1.0f - std::min(distance / SPECTATOR_MAX_RANGE_M, 1.0f);
+    float freshness = (interest.lastShown < 0.0f) ? 1.0f
+                    : std::clamp((g_director.clock - interest.lastShown) / DIRECTOR_FRESHNESS_TIME, 0.0f, 1.0f);
+    
+    float activity = 3.0f * phaseScore + 2.0f * runwayScore + 1.5f * closingScore +
+                     (interest.heavy ? 1.0f : 0.0f) + proximityScore;
+    interest.score = activity * (0.25f + 0.75f * freshness);
+    InterestHeapUpdate(static_cast<int>(entry - g_interest));
+}
+
+/**
+ * Incrementally rescore traffic: enough slots per frame that every target is
+ * refreshed about once per DIRECTOR_SCORE_INTERVAL, then drop departed targets
+ */
+static void UpdateDirectorScores(float deltaTime) {
+    g_director.clock += deltaTime;
+    g_director.subjectTime += deltaTime;
+    if (!g_spectatorDirector || g_traffic.count < 2) return;
+    
+    int targets = g_traffic.count - 1;
+    g_director.scoreBudget += targets * deltaTime / DIRECTOR_SCORE_INTERVAL;
+    int budget = std::min(static_cast<int>(g_director.scoreBudget), targets);
+    g_director.scoreBudget -= budget;
+    for (int i = 0; i < budget; i++) {
+        if (g_director.cursor <= 0 || g_director.cursor >= g_traffic.count) {
+            g_director.cursor = 1;
+        }
+        ScoreTrafficSlot(g_director.cursor++);
+        
+        // Once per sweep, forget airframes that have left the TCAS list
+        if (g_director.cursor >= g_traffic.count) {
+            for (int e = 0; e < TRAFFIC_MAX_TARGETS; e++) {
+                if (g_interest[e].modeS != 0 && g_director.clock - g_interest[e].lastSeen > DIRECTOR_FORGET_TIME) {
+                    InterestHeapRemove(e);
+                    g_interest[e].modeS = 0;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * The director's preferred target
+ * @return TCAS slot of the top-scored airframe, or -1 if it isn't in this frame's snapshot
+ */
+static int DirectorBestSlot() {
+    if (g_interestHeap.size == 0) return -1;
+    const TargetInterest& top = g_interest[g_interestHeap.entries[0]];
+    return FindTrafficSlot(g_traffic, top.modeS);
+}
+
+/**
+ * Make a TCAS slot the camera subject (-1 = the user aircraft)
+ * Shots are regenerated for the new subject's size, from the per-airframe
+ * dimension cache for traffic, and the next shot starts with a hard cut.
+ */
+static void SetSpectatorSlot(int slot) {
+    if (slot == g_spectator.slot) return;
+    
+    char msg[160];
+    if (slot > 0) {
+        snprintf(msg, sizeof(msg), "MovieCamera: Spectating %s (%s), %.1f km away\n",
+                 g_traffic.flightId[slot], g_traffic.icaoType[slot], g_traffic.distance[slot] / 1000.0f);
+    } else {
+        snprintf(msg, sizeof(msg), "MovieCamera: No traffic to spectate, framing own aircraft\n");
+    }
+    XPLMDebugString(msg);
+    
+    bool wasSpectating = g_spectator.slot > 0;
+    g_spectator.slot = slot;
+    g_spectator.cutPending = true;
+    g_director.subjectTime = 0.0f;
+    
+    if (slot > 0) {
+        TargetInterest* interest = TrafficInterest(slot);
+        if (interest) {
+            g_aircraftDims = interest->dims;
+        } else {
+            g_aircraftDims.setDefaults();
+        }
+        GenerateDynamicCameraShots();
+    } else if (wasSpectating) {
+        ReadAircraftDimensions();
+        GenerateDynamicCameraShots();
+    }
+    // The eye point belongs to the new subject; gliding from the old one would drift the first shot
+    SnapHeadAnchor();
+}
+
+/**
+ * Pick the nearest traffic target to the user aircraft within range
+ * @return TCAS slot, or -1 if there is no traffic in range
+ */
+static int FindNearestTrafficSlot() {
+    if (g_traffic.count < 2) return -1;
+    int slot = -1;
+    int found = QueryNearestTraffic(g_traffic, g_trafficGrid, g_traffic.x[0], g_traffic.y[0], g_traffic.z[0],
+                                    SPECTATOR_MAX_RANGE_M, 0, 1, &slot);
+    return found > 0 ? slot : -1;
+}
+
+/**
+ * Check whether traffic sits in the line of sight of an external shot
+ * Only the shot's start pose is tested; a drift of a few meters rarely changes it
+ */
+static bool IsShotBlockedByTraffic(const CameraShot& shot) {
+    if (shot.type != CameraType::External || shot.motion != ShotMotion::Drift || g_traffic.count < 2) {
+        return false;
+    }
+    
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    float camX, camY, camZ;
+    TransformToWorldCoordinates(shot.x, shot.y, shot.z, subject.x, subject.y, subject.z,
+                                subject.heading, subject.pitch, subject.roll, camX, camY, camZ);
+    
+    // The segment runs to the subject's centre; its own slot is excluded so it never counts as a blocker
+    int subjectSlot = std::max(g_spectator.slot, 0);
+    int hits[SHOT_OCCLUSION_MAX_HITS];
+    return QueryTrafficNearSegment(g_traffic, g_trafficGrid, camX, camY, camZ,
+                                   subject.x, subject.y, subject.z, TRAFFIC_OCCLUSION_RADIUS,
+                                   subjectSlot, SHOT_OCCLUSION_MAX_HITS, hits) > 0;
+}
+
+/**
+ * Bounding box and velocity of the camera subject for composition scoring
+ */
+static void ReadCompositionSubject(CompositionSubject& out) {
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    float half[3] = {0.5f * g_aircraftDims.wingspan, 0.5f * g_aircraftDims.height, 0.5f * g_aircraftDims.fuselageLength};
+    for (int axis = 0; axis < 3; axis++) {
+        float local[3] = {0.0f, 0.0f, 0.0f};
+        local[axis] = half[axis];
+        TransformToWorldCoordinates(local[0], local[1], local[2], 0.0f, 0.0f, 0.0f,
+                                    subject.heading, subject.pitch, subject.roll,
+                                    out.halfAxes[axis][0], out.halfAxes[axis][1], out.halfAxes[axis][2]);
+    }
+    out.center[0] = subject.x;
+    out.center[1] = subject.y;
+    out.center[2] = subject.z;
+    ReadSubjectVelocity(out.velocity[0], out.velocity[1], out.velocity[2]);
+}
+
+/**
+ * Selection weight of each exterior candidate from the composition of its opening pose
+ * The opening positions of the whole library are evaluated in one column pass
+ * (elapsed 0) and moved to world space, then drift shots get the same
+ * distance correction as the live evaluator, but without its terrain probe
+ * (the ground clamp only moves the camera up); solved shots (orbit, wingman)
+ * have no fixed opening pose and get a middling weight.
+ */
+static void WeighCandidateCompositions(const ShotList& shots, const ShotColumns& columns,
+                                       const int* candidates, int count, float* outWeights) {
+    CompositionSubject subject;
+    ReadCompositionSubject(subject);
+    SubjectPose pose;
+    ReadSubjectPose(pose);
+    EvaluateShotPositions(columns, 0.0f, DRIFT_DISTANCE_MULTIPLIER, g_shotPositions);
+    TransformShotPositions(g_shotPositions, pose.x, pose.y, pose.z, pose.heading, pose.pitch, pose.roll);
+    for (int i = 0; i < count; i++) {
+        int row = candidates[i];
+        float score = 0.5f;
+        if (shots[row].motion == ShotMotion::Drift) {
+            XPLMCameraPosition_t camera;
+            camera.x = g_shotPositions.x[row];
+            camera.y = g_shotPositions.y[row];
+            camera.z = g_shotPositions.z[row];
+            ValidateCameraPosition(camera.x, camera.y, camera.z, pose.x, pose.y, pose.z, CameraType::External);
+            camera.heading = pose.heading + columns.heading[row];
+            camera.pitch = columns.pitch[row];
+            camera.roll = columns.roll[row];
+            camera.zoom = columns.zoom[row];
+            score = ScoreComposition(subject, camera).total;
+        }
+        outWeights[i] = COMPOSITION_WEIGHT_FLOOR + score * score;
+    }
+}
+
+/**
+ * Draw a candidate position with probability proportional to its weight
+ */
+static int DrawWeightedCandidate(const float* weights, int count) {
+    float sum = 0.0f;
+    for (int i = 0; i < count; i++) {
+        sum += weights[i];
+    }
+    float target = (static_cast<float>(std::rand()) / RAND_MAX) * sum;
+    for (int i = 0; i < count - 1; i++) {
+        target -= weights[i];
+        if (target < 0.0f) return i;
+    }
+    return count - 1;
+}
+
+/**
+ * Refresh the lens and score the pose last sent to X-Plane
+ * An exterior shot that keeps the aircraft (nearly) out of frame for
+ * COMPOSITION_POOR_CUT_TIME is ended early.
+ */
+static void UpdateComposition(float deltaTime) {
+    bool controlling = g_functionActive && !g_functionPaused && g_composition.posed;
+    UpdateCompositionLens(controlling ? g_composition.lastPose.zoom : 1.0f, g_lockedFov, SCREEN_ASPECT);
+    if (!controlling || g_inTransition || g_currentShot.type != CameraType::External) {
+        g_composition.poorTime = 0.0f;
+        return;
+    }
+    
+    CompositionSubject subject;
+    ReadCompositionSubject(subject);
+    g_composition.score = ScoreComposition(subject, g_composition.lastPose);
+    if (g_composition.score.total >= COMPOSITION_POOR_SCORE) {
+        g_composition.poorTime = 0.0f;
+        return;
+    }
+    g_composition.poorTime += deltaTime;
+    if (g_composition.poorTime >= COMPOSITION_POOR_CUT_TIME && g_currentShotTime > 0.0f) {
+        char msg[128];
+        snprintf(msg, sizeof(msg), "MovieCamera: Shot '%s' lost the aircraft (composition %.2f), cutting early\n",
+                 g_currentShot.name.c_str(), g_composition.score.total);
+        XPLMDebugString(msg);
+        g_composition.poorTime = 0.0f;
+        g_currentShotTime = 0.0f;
+    }
+}
+
+/**
+ * Refresh the traffic snapshot and its spatial hash, then resolve the spectated target
+ * Runs once per frame from the flight loop (after the flight model), so the
+ * camera callback reads positions from the same frame without extra dataref calls.
+ * Traffic is read while spectating or while the camera runs (for shot planning).
+ */
+static void UpdateTraffic(float deltaTime) {
+    if (!g_trafficAvailable || (!g_enableSpectator && !g_functionActive)) {
+        g_traffic.count = 0;
+    } else {
+        g_spectator.identityTimer -= deltaTime;
+        bool withIdentity = g_spectator.identityTimer <= 0.0f;
+        if (withIdentity) {
+            g_spectator.identityTimer = SPECTATOR_IDENTITY_INTERVAL;
+        }
+        ReadTraffic(g_traffic, withIdentity);
+        BuildTrafficGrid(g_traffic, g_trafficGrid);
+    }
+    
+    if (!g_enableSpectator || g_traffic.count == 0) {
+        SetSpectatorSlot(-1);
+        return;
+    }
+    
+    UpdateDirectorScores(deltaTime);
+    
+    int slot = FindTrafficSlot(g_traffic, g_spectator.targetModeS);
+    if (slot < 0) {
+        // No target chosen, or it left - fall back to the director's pick or the nearest traffic
+        slot = g_spectatorDirector ? DirectorBestSlot() : -1;
+        if (slot < 0) {
+            slot = FindNearestTrafficSlot();
+        }
+        g_spectator.targetModeS = (slot > 0) ? g_traffic.modeS[slot] : 0;
+    }
+    SetSpectatorSlot(slot);
+    
+    if (slot > 0) {
+        g_spectator.terrainY = ProbeTerrainY(g_traffic.x[slot], g_traffic.y[slot], g_traffic.z[slot]);
+        int entry = FindInterest(g_traffic.modeS[slot], slot);
+        if (entry >= 0) {
+            g_interest[entry].lastShown = g_director.clock;
+        }
+    }
+}
+
+/**
+ * Let the director move on to a more interesting target
+ * Called at shot boundaries so the switch rides on a cut the audience expects
+ */
+static void DirectorConsiderSwitch() {
+    if (!g_spectatorDirector || !g_enableSpectator || g_director.subjectTime < DIRECTOR_MIN_DWELL) {
+        return;
+    }
+    
+    int best = DirectorBestSlot();
+    if (best <= 0 || best == g_spectator.slot) return;
+    
+    int current = (g_spectator.slot > 0) ? FindInterest(g_traffic.modeS[g_spectator.slot], g_spectator.slot) : -1;
+    int challenger = FindInterest(g_traffic.modeS[best], best);
+    if (current >= 0 && g_interest[challenger].score < g_interest[current].score * DIRECTOR_SWITCH_MARGIN) {
+        return;
+    }
+    
+    g_spectator.targetModeS = g_traffic.modeS[best];
+    SetSpectatorSlot(best);
+    g_spectator.terrainY = ProbeTerrainY(g_traffic.x[best], g_traffic.y[best], g_traffic.z[best]);
+}
+
+/**
+ * Evaluate an orbit shot in closed form
+ * The orbit lives in a heading-stabilised frame (rotates with heading only),
+ * so aircraft pitch and roll never make the circle wobble. The circle is
+ * horizontal, so its lowest point is the whole circle: a single terrain clamp
+ * per frame keeps it above ground, and the pitch is corrected to stay on target.
+ */
+static void EvaluateOrbit(const CameraShot& shot, float elapsed,
+                          float acfX, float acfY, float acfZ, float acfHeading,
+                          XPLMCameraPosition_t* outCameraPosition) {
+    float az = g_orbit.startAzimuth + g_orbit.angularRate * elapsed;
+    float sinAz, cosAz, sinH, cosH;
+    FastSinCos(az, sinAz, cosAz);
+    FastSinCos(acfHeading * PI / 180.0f, sinH, cosH);
+    
+    // Offset in the heading-stabilised frame (x right, z aft)
+    float localX = shot.orbitTargetX + g_orbit.horizontalRadius * sinAz;
+    float localZ = shot.orbitTargetZ - g_orbit.horizontalRadius * cosAz;
+    float targetY = acfY + shot.orbitTargetY;
+    
+    float camY = targetY + g_orbit.verticalOffset;
+    float clampedY = EnsureAboveGround(camY);
+    float pitch = -g_orbit.elevationDeg;
+    if (clampedY > camY && g_orbit.horizontalRadius > 0.001f) {
+        pitch = -FastAtan2(clampedY - targetY, g_orbit.horizontalRadius) * 180.0f / PI;
+    }
+    
+    outCameraPosition->x = acfX + localX * cosH - localZ * sinH;
+    outCameraPosition->y = clampedY;
+    outCameraPosition->z = acfZ + localX * sinH + localZ * cosH;
+    outCameraPosition->pitch = pitch;
+    outCameraPosition->heading = acfHeading + az * 180.0f / PI + 180.0f;
+    outCameraPosition->roll = 0.0f;
+    outCameraPosition->zoom = shot.zoom;
+}
+
+/**
+ * Current position of the two-shot partner
+ * @return false if the partner has left the traffic list
+ */
+static bool ReadTwoShotPartner(float& outX, float& outY, float& outZ) {
+    if (g_twoShot.partnerModeS == 0) {
+        outX = XPLMGetDataf(g_drLocalX);
+        outY = XPLMGetDataf(g_drLocalY);
+        outZ = XPLMGetDataf(g_drLocalZ);
+        return true;
+    }
+    int slot = FindTrafficSlot(g_traffic, g_twoShot.partnerModeS);
+    if (slot < 0) return false;
+    outX = g_traffic.x[slot];
+    outY = g_traffic.y[slot];
+    outZ = g_traffic.z[slot];
+    return true;
+}
+
+/**
+ * Solve the two-shot framing in closed form
+ * The viewing direction is fixed by the pair's baseline (broadside, swung by
+ * the azimuth offset, looking slightly down). Along it, the distance is the
+ * one at which both bounding spheres fill TWO_SHOT_FILL of the frame at the
+ * base FOV; when that distance is out of range, the zoom makes up the rest.
+ * @param ax..bz - Centres of the subject and the partner
+ * @param radius - Larger of the two bounding sphere radii
+ * @param outOffset - Camera position relative to the midpoint
+ * @param outZoom - Camera zoom
+ */
+static void SolveTwoShot(float ax, float ay, float az, float bx, float by, float bz, float radius,
+                         float outOffset[3], float& outZoom) {
+    float dx = bx - ax, dy = by - ay, dz = bz - az;
+    float horizontal = std::sqrt(dx * dx + dz * dz);
+    float baseX = 1.0f, baseZ = 0.0f;
+    if (horizontal > 1.0f) {
+        baseX = dx / horizontal;
+        baseZ = dz / horizontal;
+    }
+    
+    // Horizontal perpendicular to the baseline, swung by the azimuth offset
+    float perpX = -baseZ * g_twoShot.side, perpZ = baseX * g_twoShot.side;
+    float cosA = std::cos(g_twoShot.azimuthOffset), sinA = std::sin(g_twoShot.azimuthOffset);
+    float dirX = perpX * cosA - perpZ * sinA;
+    float dirZ = perpX * sinA + perpZ * cosA;
+    float el = TWO_SHOT_ELEVATION_DEG * PI / 180.0f;
+    float ox = dirX * std::cos(el), oy = std::sin(el), oz = dirZ * std::cos(el);
+    
+    // Camera basis: forward u = -o, right = u x up, camUp = right x u
+    float ux = -ox, uy = -oy, uz = -oz;
+    float rightLen = std::sqrt(uz * uz + ux * ux);
+    float rx = -uz / rightLen, rz = ux / rightLen;
+    float upX = -rz * uy, upY = rz * ux - rx * uz, upZ = rx * uy;
+    
+    float halfDepth = std::abs(dx * ux + dy * uy + dz * uz) * 0.5f;
+    float extentX = std::abs(dx * rx + dz * rz) * 0.5f + radius;
+    float extentY = std::abs(dx * upX + dy * upY + dz * upZ) * 0.5f + radius;
+    
+    // The nearer aircraft is halfDepth closer to the camera than the midpoint
+    float tanH = std::tan(g_lockedFov * PI / 360.0f) * TWO_SHOT_FILL;
+    float tanV = tanH / SCREEN_ASPECT;
+    float ideal = halfDepth + std::max(extentX / tanH, extentY / tanV);
+    float minDistance = halfDepth + CalculateMinVisibleDistance(g_aircraftDims) + radius;
+    float distance = std::clamp(ideal, minDistance, std::max(minDistance, TWO_SHOT_MAX_DISTANCE));
+    
+    float needTan = std::max(extentX, extentY * SCREEN_ASPECT) / (distance - halfDepth);
+    outZoom = std::clamp(tanH / needTan, TWO_SHOT_MIN_ZOOM, TWO_SHOT_MAX_ZOOM);
+    outOffset[0] = ox * distance;
+    outOffset[1] = oy * distance;
+    outOffset[2] = oz * distance;
+}
+
+/**
+ * Choose a partner for a two-shot and prime the framing
+ * The partner is the aircraft nearest the subject - traffic, or the user
+ * aircraft while spectating.
+ * @return false if nothing is close enough
+ */
+static bool PlanTwoShot() {
+    if (g_traffic.count < 2) return false;
+    
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    int subjectSlot = std::max(g_spectator.slot, 0);
+    int partner = -1;
+    if (QueryNearestTraffic(g_traffic, g_trafficGrid, subject.x, subject.y, subject.z,
+                            TWO_SHOT_MAX_SEPARATION, subjectSlot, 1, &partner) == 0) {
+        return false;
+    }
+    
+    // Traffic dimensions come from the per-airframe cache
+    AircraftDimensions partnerDims = g_userAircraftDims;
+    if (partner > 0) {
+        TargetInterest* interest = TrafficInterest(partner);
+        if (interest) {
+            partnerDims = interest->dims;
+        } else {
+            partnerDims.setDefaults();
+        }
+    }
+    
+    g_twoShot.partnerModeS = (partner > 0) ? g_traffic.modeS[partner] : 0;
+    g_twoShot.partnerRadius = 0.5f * std::max(partnerDims.wingspan, partnerDims.fuselageLength);
+    g_twoShot.side = (std::rand() % 2 == 0) ? 1.0f : -1.0f;
+    g_twoShot.azimuthOffset = ((static_cast<float>(std::rand()) / RAND_MAX) * 2.0f - 1.0f) * TWO_SHOT_MAX_AZIMUTH_DEG * PI / 180.0f;
+    
+    float radius = std::max(g_twoShot.partnerRadius, 0.5f * std::max(g_aircraftDims.wingspan, g_aircraftDims.fuselageLength));
+    float offset[3];
+    SolveTwoShot(subject.x, subject.y, subject.z, g_traffic.x[partner], g_traffic.y[partner], g_traffic.z[partner],
+                 radius, offset, g_twoShot.zoom);
+    g_twoShot.offsetX = offset[0];
+    g_twoShot.offsetY = offset[1];
+    g_twoShot.offsetZ = offset[2];
+    return true;
+}
+
+/**
+ * Re-solve the two-shot for this frame and smooth towards the solution
+ * Ends the shot early if the partner has gone
+ */
+static void UpdateTwoShot(float deltaTime) {
+    if (g_currentShot.motion != ShotMotion::TwoShot) return;
+    
+    float px, py, pz;
+    if (!ReadTwoShotPartner(px, py, pz)) {
+        g_currentShotTime = 0.0f;
+        return;
+    }
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    
+    float radius = std::max(g_twoShot.partnerRadius, 0.5f * std::max(g_aircraftDims.wingspan, g_aircraftDims.fuselageLength));
+    float offset[3], zoom;
+    SolveTwoShot(subject.x, subject.y, subject.z, px, py, pz, radius, offset, zoom);
+    
+    float alpha = 1.0f - std::exp(-deltaTime / TWO_SHOT_SMOOTHING);
+    g_twoShot.offsetX += (offset[0] - g_twoShot.offsetX) * alpha;
+    g_twoShot.offsetY += (offset[1] - g_twoShot.offsetY) * alpha;
+    g_twoShot.offsetZ += (offset[2] - g_twoShot.offsetZ) * alpha;
+    g_twoShot.zoom += (zoom - g_twoShot.zoom) * alpha;
+}
+
+/**
+ * Evaluate a two-shot: smoothed offset from the live midpoint, aimed at the midpoint
+ * The framing is delivered through the camera zoom, so the FOV datarefs stay at
+ * the shot's locked FOV and are not rewritten every frame.
+ */
+static void EvaluateTwoShot(float acfX, float acfY, float acfZ, XPLMCameraPosition_t* outCameraPosition) {
+    float px = acfX, py = acfY, pz = acfZ;
+    ReadTwoShotPartner(px, py, pz);
+    float midX = (acfX + px) * 0.5f, midY = (acfY + py) * 0.5f, midZ = (acfZ + pz) * 0.5f;
+    
+    float camX = midX + g_twoShot.offsetX;
+    float camY = EnsureAboveGround(midY + g_twoShot.offsetY);
+    float camZ = midZ + g_twoShot.offsetZ;
+    
+    // Heading 0 looks north (-Z), 90 looks east (+X)
+    float lookX = midX - camX, lookY = midY - camY, lookZ = midZ - camZ;
+    outCameraPosition->x = camX;
+    outCameraPosition->y = camY;
+    outCameraPosition->z = camZ;
+    outCameraPosition->heading = FastAtan2(lookX, -lookZ) * 180.0f / PI;
+    outCameraPosition->pitch = FastAtan2(lookY, std::sqrt(lookX * lookX + lookZ * lookZ)) * 180.0f / PI;
+    outCameraPosition->roll = 0.0f;
+    outCameraPosition->zoom = g_twoShot.zoom;
+}
+
+/**
+ * Re-convert the landmark of the current landmark shot into local coordinates
+ */
+static void ReadLandmarkLocal() {
+    const Landmark& landmark = GetLandmark(g_landmarkShot.landmark);
+    double x, y, z;
+    XPLMWorldToLocal(landmark.latitude, landmark.longitude, landmark.elevation, &x, &y, &z);
+    g_landmarkShot.x = static_cast<float>(x);
+    g_landmarkShot.y = static_cast<float>(y);
+    g_landmarkShot.z = static_cast<float>(z);
+}
+
+/**
+ * Collect search results, keep the current landmark shot's landmark in local
+ * coordinates, and periodically search along the predicted flight path
+ * The prediction is of the user aircraft, so nothing is searched while spectating.
+ */
+static void UpdateLandmarks(float deltaTime) {
+    if (!g_landmarksLoaded) return;
     
-    // Save current camera effect state before taking control
-    SaveCameraEffectState();
-    if (g_enableFovEffect) {
-        SetFovImmediate(g_lockedFov);
+    LandmarkMatch match;
+    if (TakeLandmarkMatch(match)) {
+        g_landmarkShot.match = match;
+        g_landmarkShot.matchAge = 0.0f;
+    } else {
+        g_landmarkShot.matchAge += deltaTime;
+    }
+    if (g_currentShot.motion == ShotMotion::Landmark) {
+        ReadLandmarkLocal();
     }
     
-    // Apply initial handheld effect setting if enabled
-    if (g_enableHandheldEffect && g_drHandheldCam) {
-        XPLMSetDataf(g_drHandheldCam, g_handheldIntensity);
+    g_landmarkShot.searchTimer -= deltaTime;
+    if (g_landmarkShot.searchTimer > 0.0f) return;
+    g_landmarkShot.searchTimer = LANDMARK_SEARCH_INTERVAL;
+    if (!g_enableLandmarkShots || g_spectator.slot > 0) return;
+    
+    LandmarkSearch search;
+    FlightPathSample sample;
+    for (float t = 0.0f; t <= FLIGHT_PATH_HORIZON && search.count < LANDMARK_SEARCH_MAX_POINTS; t += LANDMARK_SEARCH_STEP) {
+        if (!PredictFlightPath(t, sample)) break;
+        double altitude;
+        XPLMLocalToWorld(sample.x, sample.y, sample.z, &search.latitude[search.count], &search.longitude[search.count], &altitude);
+        search.count++;
+    }
+    if (search.count == 0) return;
+    search.maxDistance = LANDMARK_NEAR_PATH_M;
+    search.exclude = g_landmarkShot.landmark;
+    RequestLandmarkSearch(search);
+}
+
+/**
+ * Camera elevation above the aircraft for a landmark shot
+ * From altitude a ground landmark lies well below the aircraft, so the camera
+ * rises with the landmark's depression until the two are LANDMARK_FRAME_SPREAD
+ * apart vertically and the aim blend can hold both.
+ * @param range - Horizontal distance from the aircraft to the landmark (meters)
+ * @param outSpread - Depression left between aircraft and landmark (degrees, positive = landmark below)
+ */
+static float LandmarkCameraElevation(float acfY, float landmarkY, float range, float& outSpread) {
+    float depression = FastAtan2(acfY - landmarkY, std::max(range, 1.0f)) * 180.0f / PI;
+    float halfFrame = g_lockedFov * 0.5f / SCREEN_ASPECT;
+    float elevation = std::clamp(depression - halfFrame * LANDMARK_FRAME_SPREAD,
+                                 LANDMARK_CAMERA_ELEVATION_DEG, LANDMARK_MAX_CAMERA_ELEVATION_DEG);
+    outSpread = depression - elevation;
+    return elevation;
+}
+
+/**
+ * Take the latest landmark match for the next shot
+ * @return false if there is no fresh match, or the landmark is too close, too far,
+ *         or too far above or below the aircraft to frame with it now
+ */
+static bool PlanLandmarkShot() {
+    const LandmarkMatch& match = g_landmarkShot.match;
+    if (!g_enableLandmarkShots || g_spectator.slot > 0 || match.landmark < 0 ||
+        g_landmarkShot.matchAge > LANDMARK_MATCH_LIFETIME) {
+        return false;
     }
     
-    // Apply initial G-force effect setting
-    if (g_enableGForceEffect && g_drGloadedCam) {
-        XPLMSetDataf(g_drGloadedCam, 1.0f);
-    } else if (g_drGloadedCam) {
-        XPLMSetDataf(g_drGloadedCam, 0.0f);
+    int previous = g_landmarkShot.landmark;
+    g_landmarkShot.landmark = match.landmark;
+    ReadLandmarkLocal();
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    float dx = g_landmarkShot.x - subject.x, dz = g_landmarkShot.z - subject.z;
+    float range = std::sqrt(dx * dx + dz * dz);
+    float spread;
+    LandmarkCameraElevation(subject.y, g_landmarkShot.y, range, spread);
+    if (range < LANDMARK_MIN_RANGE_M || range > LANDMARK_MAX_RANGE_M ||
+        std::abs(spread) > g_lockedFov * 0.5f / SCREEN_ASPECT * LANDMARK_MAX_SPREAD) {
+        g_landmarkShot.landmark = previous;
+        return false;
     }
     
-    // Take camera control
-    XPLMControlCamera(xplm_ControlCameraForever, CameraControlCallback, nullptr);
+    g_landmarkShot.swing = ((static_cast<float>(std::rand()) / RAND_MAX) * 2.0f - 1.0f) * LANDMARK_MAX_SWING_DEG;
+    g_landmarkShot.match = LandmarkMatch();
     
-    XPLMDebugString("MovieCamera: Camera control started\n");
+    char msg[200];
+    snprintf(msg, sizeof(msg), "MovieCamera: Landmark shot - %s at %.1f km\n",
+             GetLandmark(g_landmarkShot.landmark).name.c_str(), range / 1000.0f);
+    XPLMDebugString(msg);
+    return true;
 }
 
 /**
- * Stop camera control
+ * Evaluate a landmark shot: the camera stands on the far side of the aircraft
+ * from the landmark, swung off the line between them and raised with the
+ * landmark's depression, and aims part of the way from the aircraft towards
+ * the landmark so both share the frame
  */
-static void StopCameraControl() {
-    if (!g_functionActive) return;
+static void EvaluateLandmarkShot(float acfX, float acfY, float acfZ, XPLMCameraPosition_t* outCameraPosition) {
+    float awayX = acfX - g_landmarkShot.x, awayZ = acfZ - g_landmarkShot.z;
+    float away = std::sqrt(awayX * awayX + awayZ * awayZ);
+    if (away < 1.0f) {
+        awayX = 0.0f;
+        awayZ = 1.0f;
+        away = 1.0f;
+    }
+    float sinSwing, cosSwing;
+    FastSinCos(g_landmarkShot.swing * PI / 180.0f, sinSwing, cosSwing);
+    float dirX = (awayX * cosSwing - awayZ * sinSwing) / away;
+    float dirZ = (awayX * sinSwing + awayZ * cosSwing) / away;
+    float spread, sinEl, cosEl;
+    float elevation = LandmarkCameraElevation(acfY, g_landmarkShot.y, away, spread);
+    FastSinCos(elevation * PI / 180.0f, sinEl, cosEl);
+    float distance = std::clamp(LANDMARK_CAMERA_SPANS * g_aircraftDims.wingspan,
+                                LANDMARK_MIN_CAMERA_DISTANCE, LANDMARK_MAX_CAMERA_DISTANCE);
+    
+    float camX = acfX + dirX * distance * cosEl;
+    float camY = EnsureAboveGround(acfY + distance * sinEl);
+    float camZ = acfZ + dirZ * distance * cosEl;
+    
+    // Heading 0 looks north (-Z), 90 looks east (+X)
+    float ax = acfX - camX, ay = acfY - camY, az = acfZ - camZ;
+    float lx = g_landmarkShot.x - camX, ly = g_landmarkShot.y - camY, lz = g_landmarkShot.z - camZ;
+    float headingAcf = FastAtan2(ax, -az) * 180.0f / PI;
+    float pitchAcf = FastAtan2(ay, std::sqrt(ax * ax + az * az)) * 180.0f / PI;
+    float headingLandmark = FastAtan2(lx, -lz) * 180.0f / PI;
+    float pitchLandmark = FastAtan2(ly, std::sqrt(lx * lx + lz * lz)) * 180.0f / PI;
+    
+    float maxYaw = g_lockedFov * 0.5f * LANDMARK_AIM_MAX_OFFSET;
+    float maxPitch = maxYaw / SCREEN_ASPECT;
+    outCameraPosition->x = camX;
+    outCameraPosition->y = camY;
+    outCameraPosition->z = camZ;
+    outCameraPosition->heading = headingAcf + std::clamp(NormalizeAngle(headingLandmark - headingAcf) * LANDMARK_AIM_BLEND,
+                                                         -maxYaw, maxYaw);
+    outCameraPosition->pitch = pitchAcf + std::clamp((pitchLandmark - pitchAcf) * LANDMARK_AIM_BLEND, -maxPitch, maxPitch);
+    outCameraPosition->roll = 0.0f;
+    outCameraPosition->zoom = 1.0f;
+}
+
+/**
+ * Velocity of the camera subject (local coordinates, m/s)
+ */
+static void ReadSubjectVelocity(float& outVx, float& outVy, float& outVz) {
+    int slot = g_spectator.slot;
+    if (slot > 0 && slot < g_traffic.count) {
+        outVx = g_traffic.vx[slot];
+        outVy = g_traffic.vy[slot];
+        outVz = g_traffic.vz[slot];
+        return;
+    }
+    outVx = g_drLocalVx ? XPLMGetDataf(g_drLocalVx) : 0.0f;
+    outVy = g_drLocalVy ? XPLMGetDataf(g_drLocalVy) : 0.0f;
+    outVz = g_drLocalVz ? XPLMGetDataf(g_drLocalVz) : 0.0f;
+}
+
+/**
+ * Split a frame into fixed steps
+ * Adds the frame time to the accumulator and takes whole steps out of it.
+ * After a long stall the excess is dropped rather than simulated.
+ * @return Number of FIXED_STEP steps to run
+ */
+static int ConsumeFixedSteps(float& accumulator, float deltaTime) {
+    accumulator += std::max(deltaTime, 0.0f);
+    int steps = static_cast<int>(accumulator / FIXED_STEP);
+    if (steps > FIXED_STEP_MAX_PER_FRAME) {
+        steps = FIXED_STEP_MAX_PER_FRAME;
+        accumulator = 0.0f;
+    } else {
+        accumulator -= steps * FIXED_STEP;
+    }
+    return steps;
+}
+
+/**
+ * Wingman slot in world space for the current subject pose, with a slow wander
+ */
+static void WingmanSlotTarget(const CameraShot& shot, const SubjectPose& subject,
+                              float& outX, float& outY, float& outZ) {
+    float p = g_wingman.wanderPhase;
+    float slotX = shot.x + WINGMAN_WANDER * std::sin(p);
+    float slotY = shot.y + WINGMAN_WANDER * 0.6f * std::sin(p * 1.7f + 1.0f);
+    float slotZ = shot.z + WINGMAN_WANDER * std::sin(p * 0.6f + 2.0f);
+    
+    float h = subject.heading * PI / 180.0f;
+    float sinH = std::sin(h), cosH = std::cos(h);
+    outX = subject.x + slotX * cosH - slotZ * sinH;
+    outY = subject.y + slotY;
+    outZ = subject.z + slotX * sinH + slotZ * cosH;
+}
+
+/**
+ * Put the camera body on a wingman shot's slot, behind by the join distance
+ * and matching the subject's velocity, so the shot opens with the camera
+ * ship sliding up into position
+ */
+static void PlanWingman(const CameraShot& shot) {
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    g_wingman.wanderPhase = (static_cast<float>(std::rand()) / RAND_MAX) * 2.0f * PI;
+    
+    float tx, ty, tz;
+    WingmanSlotTarget(shot, subject, tx, ty, tz);
+    float h = subject.heading * PI / 180.0f;
+    g_wingman.x = tx - std::sin(h) * WINGMAN_JOIN_DISTANCE;
+    g_wingman.y = ty;
+    g_wingman.z = tz + std::cos(h) * WINGMAN_JOIN_DISTANCE;
+    ReadSubjectVelocity(g_wingman.vx, g_wingman.vy, g_wingman.vz);
+    g_wingman.ax = g_wingman.ay = g_wingman.az = 0.0f;
+    g_wingman.accumulator = 0.0f;
+}
+
+/**
+ * One fixed step of the camera body
+ * A damped spring towards the slot, fed forward with the slot's velocity. The
+ * part of the command normal to the velocity is limited by the turn rate, the
+ * whole command by the acceleration limit; semi-implicit Euler integrates it.
+ */
+static void StepWingman(float tx, float ty, float tz, float tvx, float tvy, float tvz) {
+    constexpr float kp = WINGMAN_NATURAL_FREQ * WINGMAN_NATURAL_FREQ;
+    constexpr float kd = 2.0f * WINGMAN_DAMPING * WINGMAN_NATURAL_FREQ;
+    WingmanState& w = g_wingman;
+    float ax = kp * (tx - w.x) + kd * (tvx - w.vx);
+    float ay = kp * (ty - w.y) + kd * (tvy - w.vy);
+    float az = kp * (tz - w.z) + kd * (tvz - w.vz);
+    
+    float speedSq = w.vx * w.vx + w.vy * w.vy + w.vz * w.vz;
+    if (speedSq > 1.0f) {
+        float along = (ax * w.vx + ay * w.vy + az * w.vz) / speedSq;
+        float nx = ax - along * w.vx, ny = ay - along * w.vy, nz = az - along * w.vz;
+        float normal = std::sqrt(nx * nx + ny * ny + nz * nz);
+        float maxNormal = std::max(std::sqrt(speedSq), WINGMAN_MIN_TURN_SPEED) * WINGMAN_MAX_TURN_RATE;
+        if (normal > maxNormal) {
+            float k = maxNormal / normal;
+            ax = along * w.vx + nx * k;
+            ay = along * w.vy + ny * k;
+            az = along * w.vz + nz * k;
+        }
+    }
+    float accel = std::sqrt(ax * ax + ay * ay + az * az);
+    if (accel > WINGMAN_MAX_ACCEL) {
+        float k = WINGMAN_MAX_ACCEL / accel;
+        ax *= k; ay *= k; az *= k;
+    }
     
-    g_functionActive = false;
-    g_functionPaused = false;
+    w.vx += ax * FIXED_STEP; w.vy += ay * FIXED_STEP; w.vz += az * FIXED_STEP;
+    w.x += w.vx * FIXED_STEP; w.y += w.vy * FIXED_STEP; w.z += w.vz * FIXED_STEP;
+    w.ax = ax; w.ay = ay; w.az = az;
+}
+
+/**
+ * Advance the wingman camera body by whole fixed steps
+ * The subject is sampled once per frame; the slot at each intermediate step is
+ * extrapolated back along the subject's velocity.
+ */
+static void UpdateWingman(float deltaTime) {
+    if (g_currentShot.motion != ShotMotion::Wingman) return;
+    
+    g_wingman.wanderPhase += deltaTime * WINGMAN_WANDER_RATE;
+    int steps = ConsumeFixedSteps(g_wingman.accumulator, deltaTime);
+    if (steps == 0) return;
+    
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    float tvx, tvy, tvz;
+    ReadSubjectVelocity(tvx, tvy, tvz);
+    float tx, ty, tz;
+    WingmanSlotTarget(g_currentShot, subject, tx, ty, tz);
+    
+    for (int i = 0; i < steps; i++) {
+        float behind = (steps - 1 - i) * FIXED_STEP + g_wingman.accumulator;
+        StepWingman(tx - tvx * behind, ty - tvy * behind, tz - tvz * behind, tvx, tvy, tvz);
+    }
+}
+
+/**
+ * Evaluate a wingman shot: the camera body, extrapolated to this frame, aimed at the subject
+ * The camera banks with part of the body's sideways acceleration.
+ */
+static void EvaluateWingman(const CameraShot& shot, float acfX, float acfY, float acfZ,
+                            XPLMCameraPosition_t* outCameraPosition) {
+    float t = g_wingman.accumulator;
+    float camX = g_wingman.x + g_wingman.vx * t;
+    float camY = EnsureAboveGround(g_wingman.y + g_wingman.vy * t);
+    float camZ = g_wingman.z + g_wingman.vz * t;
+    
+    float lookX = acfX - camX, lookY = acfY - camY, lookZ = acfZ - camZ;
+    float heading = FastAtan2(lookX, -lookZ);
+    float sinH, cosH;
+    FastSinCos(heading, sinH, cosH);
+    float rightAccel = g_wingman.ax * cosH + g_wingman.az * sinH;
+    
+    outCameraPosition->x = camX;
+    outCameraPosition->y = camY;
+    outCameraPosition->z = camZ;
+    outCameraPosition->heading = heading * 180.0f / PI;
+    outCameraPosition->pitch = FastAtan2(lookY, std::sqrt(lookX * lookX + lookZ * lookZ)) * 180.0f / PI;
+    outCameraPosition->roll = FastAtan2(rightAccel, GRAVITY) * WINGMAN_BANK_FOLLOW * 180.0f / PI;
+    outCameraPosition->zoom = shot.zoom;
+}
+
+/**
+ * Evaluate a drift shot, compiled for the channels that actually move
+ * Drift shots apply consistent linear drift - like Horizon game: once the drift
+ * direction is set at shot start, it is maintained throughout. A channel whose
+ * drift is zero is a constant, so its instantiation skips that work entirely.
+ * @tparam Cockpit - Cockpit shot (eye-anchored, heading-only rotation)
+ * @tparam Moves - Position drifts
+ * @tparam Turns - Pitch, heading or roll drifts
+ * @tparam Zooms - Zoom drifts
+ */
+template <bool Cockpit, bool Moves, bool Turns, bool Zooms>
+static void EvaluateDriftShot(const CameraShot& shot, float elapsed,
+                              float acfX, float acfY, float acfZ,
+                              float acfHeading, float acfPitch, float acfRoll,
+                              XPLMCameraPosition_t* outCameraPosition) {
+    // Calculate normalized time (0 at start, 1 at end of shot)
+    float normalizedTime = 0.0f;
+    if constexpr (Moves || Turns || Zooms) {
+        normalizedTime = std::clamp(elapsed / shot.duration, 0.0f, 1.0f);
+    }
     
-    // Release camera control
-    XPLMDontControlCamera();
+    // Position drift with smooth ease-in only (no slowdown at end)
+    float driftedX = shot.x, driftedY = shot.y, driftedZ = shot.z;
+    if constexpr (Moves) {
+        driftedX = LinearDrift(shot.x, shot.driftX * shot.duration * DRIFT_DISTANCE_MULTIPLIER, normalizedTime);
+        driftedY = LinearDrift(shot.y, shot.driftY * shot.duration * DRIFT_DISTANCE_MULTIPLIER, normalizedTime);
+        driftedZ = LinearDrift(shot.z, shot.driftZ * shot.duration * DRIFT_DISTANCE_MULTIPLIER, normalizedTime);
+    }
     
-    // Restore original camera effect state
-    RestoreCameraEffectState();
+    float worldCamX, worldCamY, worldCamZ;
+    if constexpr (Cockpit) {
+        // Add the pilot eye (or the live head anchor) as base offset, so cockpit
+        // views are in the cockpit, not at the aircraft origin (CG)
+        driftedX += g_headAnchor.x;
+        driftedY += g_headAnchor.y;
+        driftedZ += g_headAnchor.z;
+        ConstrainToCockpitVolume(g_currentShotTable ? g_currentShotTable->cockpitVolume : g_shotTable->cockpitVolume,
+                                 driftedX, driftedY, driftedZ);
+        
+        // Only heading rotation (cockpit moves with aircraft)
+        float cosH, sinH;
+        FastSinCos(acfHeading * PI / 180.0f, sinH, cosH);
+        worldCamX = acfX + driftedX * cosH - driftedZ * sinH;
+        worldCamY = acfY + driftedY;
+        worldCamZ = acfZ + driftedX * sinH + driftedZ * cosH;
+    } else {
+        // Full 3D rotation keeps the camera position relative to aircraft attitude
+        TransformToWorldCoordinates(
+            driftedX, driftedY, driftedZ,
+            acfX, acfY, acfZ,
+            acfHeading, acfPitch, acfRoll,
+            worldCamX, worldCamY, worldCamZ);
+        
+        // Ensure camera doesn't go underground
+        worldCamY = EnsureAboveGround(worldCamY);
+        
+        // Validate camera position to ensure aircraft is visible (in world-space)
+        ValidateCameraPosition(worldCamX, worldCamY, worldCamZ, acfX, acfY, acfZ, shot.type);
+    }
     
-    XPLMDebugString("MovieCamera: Camera control stopped\n");
+    outCameraPosition->x = worldCamX;
+    outCameraPosition->y = worldCamY;
+    outCameraPosition->z = worldCamZ;
+    
+    // Rotation and zoom drift with same consistent direction
+    if constexpr (Turns) {
+        outCameraPosition->pitch = LinearDrift(shot.pitch, shot.driftPitch * shot.duration, normalizedTime);
+        outCameraPosition->heading = acfHeading + LinearDrift(shot.heading, shot.driftHeading * shot.duration, normalizedTime);
+        outCameraPosition->roll = LinearDrift(shot.roll, shot.driftRoll * shot.duration, normalizedTime);
+    } else {
+        outCameraPosition->pitch = shot.pitch;
+        outCameraPosition->heading = acfHeading + shot.heading;
+        outCameraPosition->roll = shot.roll;
+    }
+    if constexpr (Zooms) {
+        outCameraPosition->zoom = LinearDrift(shot.zoom, shot.driftZoom * shot.duration, normalizedTime);
+    } else {
+        outCameraPosition->zoom = shot.zoom;
+    }
+}
+
+static void EvaluateOrbitShot(const CameraShot& shot, float elapsed,
+                              float acfX, float acfY, float acfZ,
+                              float acfHeading, float acfPitch, float acfRoll,
+                              XPLMCameraPosition_t* outCameraPosition) {
+    EvaluateOrbit(shot, elapsed, acfX, acfY, acfZ, acfHeading, outCameraPosition);
+}
+
+static void EvaluateTwoShotShot(const CameraShot& shot, float elapsed,
+                                float acfX, float acfY, float acfZ,
+                                float acfHeading, float acfPitch, float acfRoll,
+                                XPLMCameraPosition_t* outCameraPosition) {
+    EvaluateTwoShot(acfX, acfY, acfZ, outCameraPosition);
+}
+
+static void EvaluateWingmanShot(const CameraShot& shot, float elapsed,
+                                float acfX, float acfY, float acfZ,
+                                float acfHeading, float acfPitch, float acfRoll,
+                                XPLMCameraPosition_t* outCameraPosition) {
+    EvaluateWingman(shot, acfX, acfY, acfZ, outCameraPosition);
+}
+
+static void EvaluateLandmarkShotShot(const CameraShot& shot, float elapsed,
+                                     float acfX, float acfY, float acfZ,
+                                     float acfHeading, float acfPitch, float acfRoll,
+                                     XPLMCameraPosition_t* outCameraPosition) {
+    EvaluateLandmarkShot(acfX, acfY, acfZ, outCameraPosition);
+}
+
+// Drift evaluators indexed [cockpit][moves][turns][zooms]
+static const ShotEvaluator g_driftEvaluators[2][2][2][2] = {
+    {{{EvaluateDriftShot<false, false, false, false>, EvaluateDriftShot<false, false, false, true>},
+      {EvaluateDriftShot<false, false, true, false>, EvaluateDriftShot<false, false, true, true>}},
+     {{EvaluateDriftShot<false, true, false, false>, EvaluateDriftShot<false, true, false, true>},
+      {EvaluateDriftShot<false, true, true, false>, EvaluateDriftShot<false, true, true, true>}}},
+    {{{EvaluateDriftShot<true, false, false, false>, EvaluateDriftShot<true, false, false, true>},
+      {EvaluateDriftShot<true, false, true, false>, EvaluateDriftShot<true, false, true, true>}},
+     {{EvaluateDriftShot<true, true, false, false>, EvaluateDriftShot<true, true, false, true>},
+      {EvaluateDriftShot<true, true, true, false>, EvaluateDriftShot<true, true, true, true>}}},
+};
+
+/**
+ * Pick the evaluator for a shot: by motion, and for drift shots by which
+ * channels are animated. Done once per cut, not per frame.
+ */
+static ShotEvaluator ChooseShotEvaluator(const CameraShot& shot) {
+    switch (shot.motion) {
+        case ShotMotion::Orbit:
+            return EvaluateOrbitShot;
+        case ShotMotion::TwoShot:
+            return EvaluateTwoShotShot;
+        case ShotMotion::Wingman:
+            return EvaluateWingmanShot;
+        case ShotMotion::Landmark:
+            return EvaluateLandmarkShotShot;
+        case ShotMotion::Drift:
+            break;
+    }
+    bool cockpit = shot.type == CameraType::Cockpit;
+    bool moves = shot.driftX != 0.0f || shot.driftY != 0.0f || shot.driftZ != 0.0f;
+    bool turns = shot.driftPitch != 0.0f || shot.driftHeading != 0.0f || shot.driftRoll != 0.0f;
+    bool zooms = shot.driftZoom != 0.0f;
+    return g_driftEvaluators[cockpit][moves][turns][zooms];
 }
 
 /**
- * Pause camera control (on mouse movement)
+ * Evaluate the current shot at a given time into the shot
  */
-static void PauseCameraControl() {
-    if (!g_functionActive || g_functionPaused) return;
-    
-    g_functionPaused = true;
-    
-    // Release camera to return to default view
-    XPLMDontControlCamera();
+static void EvaluateCurrentShot(float elapsed, float acfX, float acfY, float acfZ,
+                                float acfHeading, float acfPitch, float acfRoll,
+                                XPLMCameraPosition_t* outCameraPosition) {
+    g_currentShotEvaluator(g_currentShot, elapsed, acfX, acfY, acfZ, acfHeading, acfPitch, acfRoll, outCameraPosition);
+}
+
+/**
+ * Convert a world-space camera pose into the aircraft's heading-stabilised frame
+ * (origin at the aircraft, rotated by heading only; pitch and roll stay absolute)
+ */
+static void WorldToHeadingFrame(const XPLMCameraPosition_t& world,
+                                float acfX, float acfY, float acfZ, float acfHeading,
+                                float sinH, float cosH, XPLMCameraPosition_t& outLocal) {
+    float dx = world.x - acfX;
+    float dz = world.z - acfZ;
+    outLocal.x = dx * cosH + dz * sinH;
+    outLocal.y = world.y - acfY;
+    outLocal.z = -dx * sinH + dz * cosH;
+    outLocal.pitch = world.pitch;
+    outLocal.heading = NormalizeAngle(world.heading - acfHeading);
+    outLocal.roll = world.roll;
+    outLocal.zoom = world.zoom;
+}
+
+/**
+ * Convert a pose from the aircraft's heading-stabilised frame back to world space
+ */
+static void HeadingFrameToWorld(const XPLMCameraPosition_t& local,
+                                float acfX, float acfY, float acfZ, float acfHeading,
+                                float sinH, float cosH, XPLMCameraPosition_t* outWorld) {
+    outWorld->x = acfX + local.x * cosH - local.z * sinH;
+    outWorld->y = acfY + local.y;
+    outWorld->z = acfZ + local.x * sinH + local.z * cosH;
+    outWorld->pitch = local.pitch;
+    outWorld->heading = acfHeading + local.heading;
+    outWorld->roll = local.roll;
+    outWorld->zoom = local.zoom;
+}
+
+/**
+ * Ease-out with overshoot: passes 1 and settles back onto it
+ */
+static float EaseOutBack(float t) {
+    float u = t - 1.0f;
+    return 1.0f + (WHIP_PAN_OVERSHOOT + 1.0f) * u * u * u + WHIP_PAN_OVERSHOOT * u * u;
+}
+
+/**
+ * Angular position of the aircraft origin relative to the view axis of a pose
+ * given in the heading-stabilised frame
+ * @param outYaw - Horizontal angle from view axis to aircraft (degrees, + = right)
+ * @param outPitch - Vertical angle from view axis to aircraft (degrees, + = up)
+ */
+static void AircraftViewAngles(const XPLMCameraPosition_t& local, float& outYaw, float& outPitch) {
+    float vx = -local.x, vy = -local.y, vz = -local.z;
+    float bearing = FastAtan2(vx, -vz) * 180.0f / PI;
+    float elevation = FastAtan2(vy, std::sqrt(vx * vx + vz * vz)) * 180.0f / PI;
+    outYaw = NormalizeAngle(bearing - local.heading);
+    outPitch = elevation - local.pitch;
+}
+
+/**
+ * Pick the transition style for a cut
+ * Auto chooses a motivated style: whip-pans between cockpit and exterior,
+ * push-in/pull-out when the camera distance changes a lot, match cuts otherwise
+ */
+static TransitionStyle ResolveTransitionStyle(CameraType fromType, CameraType toType, bool& outPushIn) {
+    float startDist = std::sqrt(g_startPos.x * g_startPos.x + g_startPos.y * g_startPos.y + g_startPos.z * g_startPos.z);
+    float targetDist = std::sqrt(g_targetPos.x * g_targetPos.x + g_targetPos.y * g_targetPos.y + g_targetPos.z * g_targetPos.z);
+    outPushIn = targetDist < startDist;
+    
+    bool bothExternal = fromType == CameraType::External && toType == CameraType::External;
+    TransitionStyle style = g_transitionStyle;
+    if (style == TransitionStyle::Auto) {
+        if (fromType != toType) {
+            style = TransitionStyle::WhipPan;
+        } else if (!bothExternal) {
+            style = TransitionStyle::Cut;
+        } else if (targetDist * PUSH_DISTANCE_RATIO < startDist || targetDist > startDist * PUSH_DISTANCE_RATIO) {
+            style = TransitionStyle::PushPull;
+        } else {
+            style = TransitionStyle::MatchCut;
+        }
+    }
     
-    XPLMDebugString("MovieCamera: Camera control paused\n");
+    // Push/pull paths and match cuts only make sense around the exterior
+    if ((style == TransitionStyle::PushPull || style == TransitionStyle::MatchCut) && !bothExternal) {
+        style = TransitionStyle::Cut;
+    }
+    return style;
 }
 
 /**
- * Resume camera control after pause
+ * Precompute the transition table for the resolved style
+ * g_startPos and g_targetPos must already hold the heading-stabilised poses
+ * @return false if the style degenerates to an instant cut
  */
-static void ResumeCameraControl() {
-    if (!g_functionActive || !g_functionPaused) return;
+static bool BuildTransitionTable(TransitionStyle style, bool pushIn) {
+    const float last = static_cast<float>(TRANSITION_TABLE_SIZE - 1);
+    
+    if (style == TransitionStyle::WhipPan) {
+        // Swing away from the old shot, cut at the blur peak, swing into the new shot with overshoot
+        float diff = NormalizeAngle(g_targetPos.heading - g_startPos.heading);
+        float direction = (diff >= 0.0f) ? 1.0f : -1.0f;
+        for (int i = 0; i < TRANSITION_TABLE_SIZE; i++) {
+            float t = i / last;
+            TransitionSample& sample = g_transitionTable[i];
+            sample = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+            if (t < 0.5f) {
+                sample.headingOffset = direction * WHIP_PAN_ANGLE_DEG * EaseInCubic(t * 2.0f);
+            } else {
+                sample.weight = 1.0f;
+                sample.headingOffset = -direction * WHIP_PAN_ANGLE_DEG * (1.0f - EaseOutBack(t * 2.0f - 1.0f));
+            }
+        }
+        g_activeTransitionDuration = WHIP_PAN_DURATION;
+        return true;
+    }
     
-    g_functionPaused = false;
+    if (style == TransitionStyle::PushPull) {
+        // Collision model: aircraft bounding ellipsoid, inflated by a safety margin
+        float ax = g_aircraftDims.wingspan * 0.5f * PUSH_SAFETY_MARGIN;
+        float ay = g_aircraftDims.height * 0.5f * PUSH_SAFETY_MARGIN;
+        float az = g_aircraftDims.fuselageLength * 0.5f * PUSH_SAFETY_MARGIN;
+        
+        for (int i = 0; i < TRANSITION_TABLE_SIZE; i++) {
+            float t = i / last;
+            // Push-in accelerates into the subject, pull-out decelerates away from it
+            float w = pushIn ? t * t : 1.0f - (1.0f - t) * (1.0f - t);
+            float px = Lerp(g_startPos.x, g_targetPos.x, w);
+            float py = Lerp(g_startPos.y, g_targetPos.y, w);
+            float pz = Lerp(g_startPos.z, g_targetPos.z, w);
+            
+            TransitionSample& sample = g_transitionTable[i];
+            sample = {w, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+            float q = (px * px) / (ax * ax) + (py * py) / (ay * ay) + (pz * pz) / (az * az);
+            if (q < 1.0f) {
+                if (q < 0.0001f) {
+                    // Straight through the origin - go over the top
+                    sample.detourY = ay - py;
+                } else {
+                    float push = 1.0f / std::sqrt(q) - 1.0f;
+                    sample.detourX = px * push;
+                    sample.detourY = py * push;
+                    sample.detourZ = pz * push;
+                }
+            }
+        }
+        
+        // Smooth the detour so the path bends instead of kinking at the ellipsoid
+        for (int pass = 0; pass < 2; pass++) {
+            TransitionSample prev = g_transitionTable[0];
+            for (int i = 1; i < TRANSITION_TABLE_SIZE - 1; i++) {
+                TransitionSample cur = g_transitionTable[i];
+                const TransitionSample& next = g_transitionTable[i + 1];
+                g_transitionTable[i].detourX = (prev.detourX + 2.0f * cur.detourX + next.detourX) * 0.25f;
+                g_transitionTable[i].detourY = (prev.detourY + 2.0f * cur.detourY + next.detourY) * 0.25f;
+                g_transitionTable[i].detourZ = (prev.detourZ + 2.0f * cur.detourZ + next.detourZ) * 0.25f;
+                prev = cur;
+            }
+        }
+        g_activeTransitionDuration = g_transitionDuration;
+        return true;
+    }
     
-    // Retake camera control
-    XPLMControlCamera(xplm_ControlCameraForever, CameraControlCallback, nullptr);
+    if (style == TransitionStyle::MatchCut) {
+        // Keep the aircraft at the same screen position across the cut, then relax into the new framing
+        float startYaw, startPitch, targetYaw, targetPitch;
+        AircraftViewAngles(g_startPos, startYaw, startPitch);
+        AircraftViewAngles(g_targetPos, targetYaw, targetPitch);
+        if (std::abs(startYaw) > g_currentFov * 0.5f) {
+            // Aircraft wasn't on screen in the old shot - nothing to match
+            return false;
+        }
+        float headingCorrection = std::clamp(NormalizeAngle(targetYaw - startYaw),
+                                             -MATCH_CUT_MAX_CORRECTION_DEG, MATCH_CUT_MAX_CORRECTION_DEG);
+        float pitchCorrection = std::clamp(targetPitch - startPitch,
+                                           -MATCH_CUT_MAX_CORRECTION_DEG, MATCH_CUT_MAX_CORRECTION_DEG);
+        for (int i = 0; i < TRANSITION_TABLE_SIZE; i++) {
+            float relax = 1.0f - EaseInOutSine(i / last);
+            g_transitionTable[i] = {1.0f, 0.0f, 0.0f, 0.0f, headingCorrection * relax, pitchCorrection * relax};
+        }
+        g_activeTransitionDuration = g_transitionDuration;
+        return true;
+    }
     
-    XPLMDebugString("MovieCamera: Camera control resumed\n");
+    return false;
+}
+
+/**
+ * Begin the transition into g_currentShot
+ * Called at cut time: captures the outgoing camera pose, resolves the style
+ * and precomputes the whole path so per-frame evaluation is a table lookup
+ */
+static void BeginShotTransition(CameraType fromType) {
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    float h = subject.heading * PI / 180.0f;
+    float sinH = std::sin(h), cosH = std::cos(h);
+    
+    XPLMCameraPosition_t current;
+    XPLMReadCameraPosition(&current);
+    WorldToHeadingFrame(current, subject.x, subject.y, subject.z, subject.heading, sinH, cosH, g_startPos);
+    
+    XPLMCameraPosition_t target;
+    EvaluateCurrentShot(0.0f, subject.x, subject.y, subject.z,
+                        subject.heading, subject.pitch, subject.roll, &target);
+    WorldToHeadingFrame(target, subject.x, subject.y, subject.z, subject.heading, sinH, cosH, g_targetPos);
+    
+    // A new subject can be kilometres away from the old one - never fly there
+    bool pushIn = false;
+    g_activeTransitionStyle = g_spectator.cutPending ? TransitionStyle::Cut
+                                                     : ResolveTransitionStyle(fromType, g_currentShot.type, pushIn);
+    g_spectator.cutPending = false;
+    g_inTransition = BuildTransitionTable(g_activeTransitionStyle, pushIn);
+    if (!g_inTransition) {
+        g_activeTransitionStyle = TransitionStyle::Cut;
+    }
+    g_transitionProgress = 0.0f;
+}
+
+/**
+ * Begin a transition from the user's own view back into g_currentShot
+ * Only cockpit shots resumed from a cockpit view blend - the path is a straight
+ * push from the head, which would pass through the airframe from outside.
+ * Anything else resumes the shot (or the cut in progress) where it was.
+ */
+static void BeginResumeTransition() {
+    if (g_currentShot.type != CameraType::Cockpit || g_spectator.slot > 0) return;
+    
+    SubjectPose subject;
+    ReadSubjectPose(subject);
+    float h = subject.heading * PI / 180.0f;
+    float sinH = std::sin(h), cosH = std::cos(h);
+    
+    XPLMCameraPosition_t current;
+    XPLMReadCameraPosition(&current);
+    WorldToHeadingFrame(current, subject.x, subject.y, subject.z, subject.heading, sinH, cosH, g_startPos);
+    float dx = g_startPos.x - g_headAnchor.x;
+    float dy = g_startPos.y - g_headAnchor.y;
+    float dz = g_startPos.z - g_headAnchor.z;
+    if (dx * dx + dy * dy + dz * dz > HEAD_RESUME_MAX_DISTANCE * HEAD_RESUME_MAX_DISTANCE) return;
+    
+    // Blend into the shot's start pose; its drift restarts when the blend ends
+    XPLMCameraPosition_t target;
+    EvaluateCurrentShot(0.0f, subject.x, subject.y, subject.z,
+                        subject.heading, subject.pitch, subject.roll, &target);
+    WorldToHeadingFrame(target, subject.x, subject.y, subject.z, subject.heading, sinH, cosH, g_targetPos);
+    
+    const float last = static_cast<float>(TRANSITION_TABLE_SIZE - 1);
+    for (int i = 0; i < TRANSITION_TABLE_SIZE; i++) {
+        g_transitionTable[i] = {EaseInOutSine(i / last), 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    }
+    g_activeTransitionStyle = TransitionStyle::PushPull;
+    g_activeTransitionDuration = g_transitionDuration;
+    g_transitionProgress = 0.0f;
+    g_inTransition = true;
+}
+
+/**
+ * Evaluate the active transition: one table lookup blended between the
+ * frozen outgoing pose and the live start pose of the incoming shot
+ */
+static void EvaluateTransition(float acfX, float acfY, float acfZ,
+                               float acfHeading, float acfPitch, float acfRoll,
+                               XPLMCameraPosition_t* outCameraPosition) {
+    float h = acfHeading * PI / 180.0f;
+    float sinH = std::sin(h), cosH = std::cos(h);
+    
+    XPLMCameraPosition_t target;
+    EvaluateCurrentShot(0.0f, acfX, acfY, acfZ, acfHeading, acfPitch, acfRoll, &target);
+    WorldToHeadingFrame(target, acfX, acfY, acfZ, acfHeading, sinH, cosH, g_targetPos);
+    
+    float index = std::clamp(g_transitionProgress, 0.0f, 1.0f) * (TRANSITION_TABLE_SIZE - 1);
+    int i0 = std::min(static_cast<int>(index), TRANSITION_TABLE_SIZE - 2);
+    float f = index - static_cast<float>(i0);
+    const TransitionSample& a = g_transitionTable[i0];
+    const TransitionSample& b = g_transitionTable[i0 + 1];
+    // Whip-pans switch pose mid-table; never interpolate the weight across that step
+    float w = (g_activeTransitionStyle == TransitionStyle::WhipPan) ? (f < 0.5f ? a.weight : b.weight) : Lerp(a.weight, b.weight, f);
+    
+    XPLMCameraPosition_t local;
+    local.x = Lerp(g_startPos.x, g_targetPos.x, w) + Lerp(a.detourX, b.detourX, f);
+    local.y = Lerp(g_startPos.y, g_targetPos.y, w) + Lerp(a.detourY, b.detourY, f);
+    local.z = Lerp(g_startPos.z, g_targetPos.z, w) + Lerp(a.detourZ, b.detourZ, f);
+    local.pitch = Lerp(g_startPos.pitch, g_targetPos.pitch, w) + Lerp(a.pitchOffset, b.pitchOffset, f);
+    local.heading = LerpAngle(g_startPos.heading, g_targetPos.heading, w) + Lerp(a.headingOffset, b.headingOffset, f);
+    local.roll = Lerp(g_startPos.roll, g_targetPos.roll, w);
+    local.zoom = Lerp(g_startPos.zoom, g_targetPos.zoom, w);
+    
+    HeadingFrameToWorld(local, acfX, acfY, acfZ, acfHeading, sinH, cosH, outCameraPosition);
+    
+    // Ensure camera doesn't go underground during transition (for external shots)
+    if (g_currentShot.type == CameraType::External) {
+        outCameraPosition->y = EnsureAboveGround(outCameraPosition->y);
+    }
 }
 
 /**
@@ -1745,97 +5280,18 @@ static int CameraControlCallback(XPLMCameraPosition_t* outCameraPosition, int in
         return 0;
     }
     
-    // Get current aircraft position and orientation
-    float acfX = XPLMGetDataf(g_drLocalX);
-    float acfY = XPLMGetDataf(g_drLocalY);
-    float acfZ = XPLMGetDataf(g_drLocalZ);
-    float acfHeading = XPLMGetDataf(g_drHeading);
-    float acfPitch = XPLMGetDataf(g_drPitch);
-    float acfRoll = XPLMGetDataf(g_drRoll);
+    // Get current position and orientation of the subject (own aircraft or spectated traffic)
+    SubjectPose subject;
+    ReadSubjectPose(subject);
     
     if (g_inTransition) {
-        // Smooth transition between shots using ease-in-out
-        float t = EaseInOutCubic(g_transitionProgress);
-        
-        float transX = Lerp(g_startPos.x, g_targetPos.x, t);
-        float transY = Lerp(g_startPos.y, g_targetPos.y, t);
-        float transZ = Lerp(g_startPos.z, g_targetPos.z, t);
-        
-        // Ensure camera doesn't go underground during transition (for external shots)
-        if (g_currentShot.type == CameraType::External) {
-            transY = EnsureAboveGround(transY);
-        }
-        
-        outCameraPosition->x = transX;
-        outCameraPosition->y = transY;
-        outCameraPosition->z = transZ;
-        outCameraPosition->pitch = Lerp(g_startPos.pitch, g_targetPos.pitch, t);
-        outCameraPosition->heading = LerpAngle(g_startPos.heading, g_targetPos.heading, t);
-        outCameraPosition->roll = Lerp(g_startPos.roll, g_targetPos.roll, t);
-        outCameraPosition->zoom = Lerp(g_startPos.zoom, g_targetPos.zoom, t);
+        EvaluateTransition(subject.x, subject.y, subject.z, subject.heading, subject.pitch, subject.roll, outCameraPosition);
     } else {
-        // Apply shot with consistent linear drift - like Horizon game
-        // Once drift direction is set at shot start, maintain it throughout
-        
-        // Calculate normalized time (0 at start, 1 at end of shot)
-        float normalizedTime = g_shotElapsedTime / g_currentShot.duration;
-        normalizedTime = std::clamp(normalizedTime, 0.0f, 1.0f);
-        
-        // Position drift with smooth ease-in only (no slowdown at end)
-        float driftedX = LinearDrift(g_currentShot.x, g_currentShot.driftX * g_currentShot.duration * DRIFT_DISTANCE_MULTIPLIER, normalizedTime);
-        float driftedY = LinearDrift(g_currentShot.y, g_currentShot.driftY * g_currentShot.duration * DRIFT_DISTANCE_MULTIPLIER, normalizedTime);
-        float driftedZ = LinearDrift(g_currentShot.z, g_currentShot.driftZ * g_currentShot.duration * DRIFT_DISTANCE_MULTIPLIER, normalizedTime);
-        
-        // For cockpit shots, add pilot eye position as base offset
-        // This ensures cockpit views are in the cockpit, not at the aircraft origin (CG)
-        if (g_currentShot.type == CameraType::Cockpit) {
-            driftedX += g_aircraftDims.pilotEyeX;
-            driftedY += g_aircraftDims.pilotEyeY;
-            driftedZ += g_aircraftDims.pilotEyeZ;
-        }
-        
-        // Rotation drift with same consistent direction
-        float driftedPitch = LinearDrift(g_currentShot.pitch, g_currentShot.driftPitch * g_currentShot.duration, normalizedTime);
-        float driftedHeading = LinearDrift(g_currentShot.heading, g_currentShot.driftHeading * g_currentShot.duration, normalizedTime);
-        float driftedRoll = LinearDrift(g_currentShot.roll, g_currentShot.driftRoll * g_currentShot.duration, normalizedTime);
-        
-        // Zoom drift with same consistent direction
-        float driftedZoom = LinearDrift(g_currentShot.zoom, g_currentShot.driftZoom * g_currentShot.duration, normalizedTime);
-        
-        float worldCamX, worldCamY, worldCamZ;
-        
-        if (g_currentShot.type == CameraType::External) {
-            // For external shots, use full 3D rotation to keep camera position
-            // relative to aircraft attitude (pitch, roll, heading)
-            TransformToWorldCoordinates(
-                driftedX, driftedY, driftedZ,
-                acfX, acfY, acfZ,
-                acfHeading, acfPitch, acfRoll,
-                worldCamX, worldCamY, worldCamZ);
-            
-            // Ensure camera doesn't go underground
-            worldCamY = EnsureAboveGround(worldCamY);
-            
-            // Validate camera position to ensure aircraft is visible (in world-space)
-            ValidateCameraPosition(worldCamX, worldCamY, worldCamZ, acfX, acfY, acfZ, g_currentShot.type);
-        } else {
-            // For cockpit shots, only use heading rotation (cockpit moves with aircraft)
-            float rad = acfHeading * PI / 180.0f;
-            float cosH = std::cos(rad);
-            float sinH = std::sin(rad);
-            worldCamX = acfX + driftedX * cosH - driftedZ * sinH;
-            worldCamY = acfY + driftedY;
-            worldCamZ = acfZ + driftedX * sinH + driftedZ * cosH;
-        }
-        
-        outCameraPosition->x = worldCamX;
-        outCameraPosition->y = worldCamY;
-        outCameraPosition->z = worldCamZ;
-        outCameraPosition->pitch = driftedPitch;
-        outCameraPosition->heading = acfHeading + driftedHeading;
-        outCameraPosition->roll = driftedRoll;
-        outCameraPosition->zoom = driftedZoom;
+        EvaluateCurrentShot(g_shotElapsedTime, subject.x, subject.y, subject.z,
+                            subject.heading, subject.pitch, subject.roll, outCameraPosition);
     }
+    g_composition.lastPose = *outCameraPosition;
+    g_composition.posed = true;
     
     return 1;
 }
@@ -1869,6 +5325,36 @@ static float FlightLoopCallback(float inElapsedSinceLastCall, float inElapsedTim
         g_mouseIdleTime += inElapsedSinceLastCall;
     }
     
+    // A shot table built since the last frame takes effect from the next cut
+    AdoptPendingShotTable();
+    
+    // Flight phase drives shot families, pacing and auto activation
+    UpdateFlightPhase(inElapsedSinceLastCall);
+    UpdateTraffic(inElapsedSinceLastCall);
+    UpdateInstrumentCues(inElapsedSinceLastCall);
+    UpdateFlightPath(inElapsedSinceLastCall);
+    UpdateLandmarks(inElapsedSinceLastCall);
+    UpdateComposition(inElapsedSinceLastCall);
+    UpdateHeadAnchor(inElapsedSinceLastCall);
+    const AircraftData* aircraftData = g_aircraftPublished.load(std::memory_order_acquire);
+    if (!g_poiApplied && aircraftData) {
+        g_poiApplied = true;
+        char msg[160];
+        snprintf(msg, sizeof(msg), "MovieCamera: Cockpit points of interest %s (%s)\n",
+                 aircraftData->pois ? "ready" : "unavailable", aircraftData->poiMessage);
+        XPLMDebugString(msg);
+        // The worker's table is published before the POIs, but is dropped if the
+        // subject or settings changed while it was built; aim from here then
+        AdoptPendingShotTable();
+        if (aircraftData->pois && g_spectator.slot <= 0 && !g_shotTable->poisAimed) {
+            GenerateDynamicCameraShots();
+        }
+    }
+    if (g_functionActive) {
+        UpdateTwoShot(inElapsedSinceLastCall);
+        UpdateWingman(inElapsedSinceLastCall);
+    }
+    
     // Handle auto mode
     if (g_pluginMode == PluginMode::Auto) {
         bool conditionsMet = CheckAutoConditions();
@@ -1888,10 +5374,20 @@ static float FlightLoopCallback(float inElapsedSinceLastCall, float inElapsedTim
         }
     }
     
+    // The music clock keeps running through pauses - the recording does too
+    if (g_functionActive) {
+        g_musicClock += inElapsedSinceLastCall;
+    }
+    
     // Update camera shot timing
     if (g_functionActive && !g_functionPaused) {
+        if (g_spectator.cutPending) {
+            // The subject changed - end the current shot now so the next one starts on it
+            g_inTransition = false;
+            g_currentShotTime = 0.0f;
+        }
         if (g_inTransition) {
-            g_transitionProgress += inElapsedSinceLastCall / g_transitionDuration;
+            g_transitionProgress += inElapsedSinceLastCall / g_activeTransitionDuration;
             if (g_transitionProgress >= 1.0f) {
                 g_inTransition = false;
                 g_transitionProgress = 0.0f;
@@ -1905,42 +5401,13 @@ static float FlightLoopCallback(float inElapsedSinceLastCall, float inElapsedTim
             g_currentShotTime -= inElapsedSinceLastCall;
             if (g_currentShotTime <= 0.0f) {
                 // Time for next shot
-                XPLMReadCameraPosition(&g_startPos);
-                
+                CameraType previousType = g_currentShot.type;
+                DirectorConsiderSwitch();
                 CameraShot nextShot = SelectNextShot();
+                BeginShotTransition(previousType);
                 
-                // Calculate target position (start position for the new shot)
-                float acfX = XPLMGetDataf(g_drLocalX);
-                float acfY = XPLMGetDataf(g_drLocalY);
-                float acfZ = XPLMGetDataf(g_drLocalZ);
-                float acfHeading = XPLMGetDataf(g_drHeading);
-                
-                float rad = acfHeading * PI / 180.0f;
-                float cosH = std::cos(rad);
-                float sinH = std::sin(rad);
-                
-                // For cockpit shots, add pilot eye position as base offset
-                float shotX = nextShot.x;
-                float shotY = nextShot.y;
-                float shotZ = nextShot.z;
-                if (nextShot.type == CameraType::Cockpit) {
-                    shotX += g_aircraftDims.pilotEyeX;
-                    shotY += g_aircraftDims.pilotEyeY;
-                    shotZ += g_aircraftDims.pilotEyeZ;
-                }
-                
-                g_targetPos.x = acfX + shotX * cosH - shotZ * sinH;
-                g_targetPos.y = acfY + shotY;
-                g_targetPos.z = acfZ + shotX * sinH + shotZ * cosH;
-                g_targetPos.pitch = nextShot.pitch;
-                g_targetPos.heading = acfHeading + nextShot.heading;
-                g_targetPos.roll = nextShot.roll;
-                g_targetPos.zoom = nextShot.zoom;
-                
-                // Instant camera switch - no smooth transition
-                g_inTransition = false;
-                g_transitionProgress = 0.0f;
-                g_currentShotTime = nextShot.duration;
+                g_currentShot.duration = AlignShotDurationToBeat(nextShot.duration, g_inTransition ? g_activeTransitionDuration : 0.0f);
+                g_currentShotTime = g_currentShot.duration;
                 if (g_enableFovEffect) {
                     SetFovImmediate(g_lockedFov);
                 }
@@ -1951,6 +5418,36 @@ static float FlightLoopCallback(float inElapsedSinceLastCall, float inElapsedTim
     return -1.0f;  // Call every frame
 }
 
+/**
+ * Log the recorded startup phases as one table and check the startup budget
+ * The first enable includes XPluginStart; later re-enables only themselves.
+ */
+static void LogStartupProfile() {
+    const ProfilePhase* phases = nullptr;
+    int count = GetProfilePhases(phases);
+    double totalMs = 0.0;
+    bool overBudget = IsProfileOverBudget(STARTUP_TIME_BUDGET_MS, totalMs);
+    
+    XPLMDebugString("MovieCamera: Startup phases (ms)\n");
+    for (int i = 0; i < count; i++) {
+        const ProfilePhase& phase = phases[i];
+        double ms = phase.seconds * 1000.0;
+        char msg[128];
+        snprintf(msg, sizeof(msg), "MovieCamera:   %*s%-*s %8.2f\n",
+                 phase.depth * 2, "", 30 - phase.depth * 2, phase.name, ms);
+        XPLMDebugString(msg);
+    }
+    char msg[160];
+    snprintf(msg, sizeof(msg), "MovieCamera:   %-30s %8.2f (budget %.0f)\n", "Total", totalMs, STARTUP_TIME_BUDGET_MS);
+    XPLMDebugString(msg);
+    if (overBudget) {
+        snprintf(msg, sizeof(msg), "MovieCamera: WARNING - startup took %.1f ms, over the %.0f ms budget\n",
+                 totalMs, STARTUP_TIME_BUDGET_MS);
+        XPLMDebugString(msg);
+    }
+    ClearProfilePhases();
+}
+
 /**
  * Plugin start
  */
@@ -1960,19 +5457,25 @@ PLUGIN_API int XPluginStart(char* outName, char* outSig, char* outDesc) {
     std::strcpy(outDesc, PLUGIN_DESCRIPTION);
     
     XPLMDebugString("MovieCamera: Plugin starting...\n");
+    BeginProfilePhase("XPluginStart");
     
     // Find datarefs
+    BeginProfilePhase("FindDataRef");
     g_drLatitude = XPLMFindDataRef("sim/flightmodel/position/latitude");
     g_drLongitude = XPLMFindDataRef("sim/flightmodel/position/longitude");
     g_drElevation = XPLMFindDataRef("sim/flightmodel/position/elevation");
     g_drLocalX = XPLMFindDataRef("sim/flightmodel/position/local_x");
     g_drLocalY = XPLMFindDataRef("sim/flightmodel/position/local_y");
     g_drLocalZ = XPLMFindDataRef("sim/flightmodel/position/local_z");
+    g_drLocalVx = XPLMFindDataRef("sim/flightmodel/position/local_vx");
+    g_drLocalVy = XPLMFindDataRef("sim/flightmodel/position/local_vy");
+    g_drLocalVz = XPLMFindDataRef("sim/flightmodel/position/local_vz");
     g_drPitch = XPLMFindDataRef("sim/flightmodel/position/theta");
     g_drRoll = XPLMFindDataRef("sim/flightmodel/position/phi");
     g_drHeading = XPLMFindDataRef("sim/flightmodel/position/psi");
     g_drGroundSpeed = XPLMFindDataRef("sim/flightmodel/position/groundspeed");
     g_drOnGround = XPLMFindDataRef("sim/flightmodel/failures/onground_any");
+    g_drVerticalSpeed = XPLMFindDataRef("sim/flightmodel/position/vh_ind_fpm");
     g_drElevationM = XPLMFindDataRef("sim/flightmodel/position/elevation");  // Returns meters
     g_drPilotX = XPLMFindDataRef("sim/graphics/view/pilots_head_x");
     g_drPilotY = XPLMFindDataRef("sim/graphics/view/pilots_head_y");
@@ -1996,6 +5499,27 @@ PLUGIN_API int XPluginStart(char* outName, char* outSig, char* outDesc) {
         XPLMDebugString("MovieCamera: Handheld camera dataref not found - handheld effect disabled\n");
     }
     
+    // Live projection for composition scoring
+    InitComposition();
+    
+    // Sun position for orbit lighting
+    g_drSunPitch = XPLMFindDataRef("sim/graphics/scenery/sun_pitch_degrees");
+    g_drSunHeading = XPLMFindDataRef("sim/graphics/scenery/sun_heading_degrees");
+    
+    // Cockpit controls for instrument cues
+    InitInstrumentWatch();
+    
+    // Autopilot state for the flight path prediction
+    InitFlightPath();
+    
+    // Traffic for spectator mode
+    g_trafficAvailable = InitTraffic();
+    ResetDirector();
+    g_terrainProbe = XPLMCreateProbe(xplm_ProbeY);
+    if (!g_trafficAvailable) {
+        XPLMDebugString("MovieCamera: TCAS traffic datarefs not found, spectator mode unavailable\n");
+    }
+    
     // Terrain height dataref for ground collision prevention
     g_drTerrainY = XPLMFindDataRef("sim/flightmodel/position/y_agl");
     // Fallback: if y_agl not available, calculate from local_y - elevation
@@ -2025,6 +5549,7 @@ PLUGIN_API int XPluginStart(char* outName, char* outSig, char* outDesc) {
     g_drAcfPeX = XPLMFindDataRef("sim/aircraft/view/acf_peX");   // Pilot eye X (lateral offset)
     g_drAcfPeY = XPLMFindDataRef("sim/aircraft/view/acf_peY");   // Pilot eye Y (height from CG)
     g_drAcfPeZ = XPLMFindDataRef("sim/aircraft/view/acf_peZ");   // Pilot eye Z (longitudinal from CG)
+    EndProfilePhase();
     
     // Log which datarefs were found
     char msg[512];
@@ -2036,7 +5561,9 @@ PLUGIN_API int XPluginStart(char* outName, char* outSig, char* outDesc) {
     
     // Initialize with dynamic camera shots based on default aircraft dimensions
     // Will be regenerated when aircraft data is loaded
+    BeginProfilePhase("GenerateDynamicCameraShots");
     GenerateDynamicCameraShots();
+    EndProfilePhase();
     
     // Create menu
     int pluginMenuIndex = XPLMAppendMenuItem(XPLMFindPluginsMenu(), PLUGIN_NAME, nullptr, 0);
@@ -2049,6 +5576,7 @@ PLUGIN_API int XPluginStart(char* outName, char* outSig, char* outDesc) {
     g_menuItemSettings = XPLMAppendMenuItem(g_menuId, "Settings", reinterpret_cast<void*>(3), 0);
     
     UpdateMenuState();
+    EndProfilePhase();
     
     XPLMDebugString("MovieCamera: Plugin started successfully\n");
     
@@ -2067,6 +5595,19 @@ PLUGIN_API void XPluginStop(void) {
         g_menuId = nullptr;
     }
     
+    if (g_terrainProbe) {
+        XPLMDestroyProbe(g_terrainProbe);
+        g_terrainProbe = nullptr;
+    }
+    
+    // Shot tables: one published but never adopted is owned by nobody else
+    delete g_pendingShotTable.exchange(nullptr, std::memory_order_acquire);
+    g_currentShotTable.reset();
+    g_shotTable = std::make_shared<const ShotTable>();
+    StopCockpitPoiExtraction();
+    ResetAircraftData();
+    ReleaseArenaPool();
+    
     XPLMDebugString("MovieCamera: Plugin stopped\n");
 }
 
@@ -2075,6 +5616,7 @@ PLUGIN_API void XPluginStop(void) {
  */
 PLUGIN_API int XPluginEnable(void) {
     XPLMDebugString("MovieCamera: Plugin enabling...\n");
+    BeginProfilePhase("XPluginEnable");
     
     // Create flight loop
     XPLMCreateFlightLoop_t flightLoopParams;
@@ -2087,8 +5629,10 @@ PLUGIN_API int XPluginEnable(void) {
     XPLMScheduleFlightLoop(g_flightLoopId, -1.0f, 1);
     
     // Create settings window
+    BeginProfilePhase("SettingsWindow");
     g_settingsWindow = std::make_unique<SettingsWindow>();
     g_settingsWindow->SetVisible(false);
+    EndProfilePhase();
     
     // Get initial mouse position
     XPLMGetMouseLocation(&g_lastMouseX, &g_lastMouseY);
@@ -2097,11 +5641,51 @@ PLUGIN_API int XPluginEnable(void) {
     std::srand(static_cast<unsigned>(std::time(nullptr)));
     
     // Load user settings
+    BeginProfilePhase("LoadSettings");
     LoadSettings();
+    LoadProfiles();
+    RegisterProfileCommands();
+    EndProfilePhase();
+    
+    // Pick up the beat timeline (usually straight from the cache)
+    if (g_enableBeatSync && g_beatAudioPath[0] != '\0') {
+        StartBeatAnalysis();
+    }
+    
+    // Enabled in flight, auto mode must not see a Parked phase change under it
+    SeedFlightPhase();
     
     // Read aircraft dimensions and generate dynamic camera shots
+    BeginProfilePhase("ReadAircraftDimensions");
     ReadAircraftDimensions();
+    EndProfilePhase();
+    BeginProfilePhase("GenerateDynamicCameraShots");
     GenerateDynamicCameraShots();
+    EndProfilePhase();
+    StartCockpitPoiExtraction();
+    
+    // AI models loaded before we were enabled never send PLANE_LOADED to us
+    BeginProfilePhase("ModelDimensionCache");
+    StartModelDimensionCache(GetPluginPath() + "model_dims.cache");
+    int totalAircraft = 0, activeAircraft = 0;
+    XPLMPluginID controller = XPLM_NO_PLUGIN_ID;
+    XPLMCountAircraft(&totalAircraft, &activeAircraft, &controller);
+    for (int i = 1; i < activeAircraft && i < MODEL_CACHE_MAX_AIRCRAFT; i++) {
+        RequestAircraftModel(i);
+    }
+    EndProfilePhase();
+    
+    // Landmarks to find along the flight path; StopLandmarks undoes this on disable
+    BeginProfilePhase("Landmarks");
+    g_landmarksLoaded = StartLandmarks(GetPluginPath() + "landmarks.csv", g_landmarkMessage);
+    g_landmarkShot.match = LandmarkMatch();
+    g_landmarkShot.landmark = -1;
+    char landmarkMsg[160];
+    snprintf(landmarkMsg, sizeof(landmarkMsg), "MovieCamera: Landmarks: %s\n", g_landmarkMessage.c_str());
+    XPLMDebugString(landmarkMsg);
+    EndProfilePhase();
+    EndProfilePhase();
+    LogStartupProfile();
     
     XPLMDebugString("MovieCamera: Plugin enabled\n");
     
@@ -2116,12 +5700,21 @@ PLUGIN_API void XPluginDisable(void) {
     
     // Save user settings
     SaveSettings();
+    UnregisterProfileCommands();
     
     // Stop camera control if active
     if (g_functionActive) {
         StopCameraControl();
     }
     
+    // Don't leave the beat analysis worker running
+    StopBeatAnalysis();
+    StopModelDimensionCache();
+    StopCockpitPoiExtraction();
+    StopLandmarks();
+    g_landmarksLoaded = false;
+    g_landmarkShot.match = LandmarkMatch();
+    
     // Destroy flight loop
     if (g_flightLoopId) {
         XPLMDestroyFlightLoop(g_flightLoopId);
@@ -2147,7 +5740,33 @@ PLUGIN_API void XPluginReceiveMessage(XPLMPluginID inFrom, int inMsg, void* inPa
         g_mouseIdleTime = 0.0f;
         
         XPLMDebugString("MovieCamera: User aircraft loaded, reading dimensions...\n");
-        ReadAircraftDimensions();
-        GenerateDynamicCameraShots();
+        ResetInstrumentWatch();
+        ResetFlightPath();
+        SeedFlightPhase();
+        g_headAnchor.valid = false;
+        // While spectating, the shots belong to the target; the user aircraft is re-read on return
+        if (g_spectator.slot <= 0) {
+            ReadAircraftDimensions();
+            GenerateDynamicCameraShots();
+        }
+        StartCockpitPoiExtraction();
+    } else if (inMsg == XPLM_MSG_PLANE_LOADED) {
+        // An AI aircraft was (re)loaded - its slot may now hold a different airframe,
+        // so refresh flight IDs/types on the next frame. The target itself is
+        // re-resolved by mode-S ID every frame.
+        int index = static_cast<int>(reinterpret_cast<intptr_t>(inParam));
+        char msg[96];
+        snprintf(msg, sizeof(msg), "MovieCamera: AI aircraft %d loaded\n", index);
+        XPLMDebugString(msg);
+        g_spectator.identityTimer = 0.0f;
+        RequestAircraftModel(index);
+        
+        // An airframe kept in this slot must not keep the old model's dimensions
+        if (index < g_traffic.count) {
+            int entry = FindInterest(g_traffic.modeS[index], index);
+            if (entry >= 0) g_interest[entry].dimsSource = DimsSource::Default;
+        }
+    } else if (inMsg == XPLM_MSG_PLANE_UNLOADED && reinterpret_cast<intptr_t>(inParam) != 0) {
+        RequestModelDimensions(static_cast<int>(reinterpret_cast<intptr_t>(inParam)), "");
     }
 }
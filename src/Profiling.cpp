@@ -0,0 +1,84 @@
+/**
+ * Profiling - timing helpers for benchmarks and startup profiling
+ * See Profiling.h for an overview.
+ */
+
+#include "Profiling.h"
+
+#include <algorithm>
+#include <chrono>
+
+static ProfilePhase s_phases[PROFILE_MAX_PHASES];
+static double s_phaseStart[PROFILE_MAX_PHASES];
+static int s_phaseCount = 0;
+static int s_openStack[PROFILE_MAX_PHASES];     // Indices of open phases, innermost last
+static int s_openCount = 0;
+
+double ProfileSeconds() {
+    using Clock = std::chrono::steady_clock;
+    return std::chrono::duration<double>(Clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Nearest-rank percentile of sorted samples
+ */
+static float Percentile(const std::vector<float>& sorted, float fraction) {
+    size_t rank = static_cast<size_t>(fraction * static_cast<float>(sorted.size() - 1) + 0.5f);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+CostSummary SummariseCosts(std::vector<float>& samplesUs) {
+    CostSummary summary;
+    if (samplesUs.empty()) return summary;
+
+    std::sort(samplesUs.begin(), samplesUs.end());
+    double total = 0.0;
+    for (float sample : samplesUs) {
+        total += sample;
+    }
+    summary.count = static_cast<int>(samplesUs.size());
+    summary.mean = static_cast<float>(total / static_cast<double>(samplesUs.size()));
+    summary.p50 = Percentile(samplesUs, 0.50f);
+    summary.p95 = Percentile(samplesUs, 0.95f);
+    summary.p99 = Percentile(samplesUs, 0.99f);
+    summary.max = samplesUs.back();
+    return summary;
+}
+
+void BeginProfilePhase(const char* name) {
+    // A phase that doesn't fit is still pushed (as -1) so Begin/End stay paired
+    int index = (s_phaseCount < PROFILE_MAX_PHASES) ? s_phaseCount++ : -1;
+    if (index >= 0) {
+        s_phases[index] = {name, s_openCount, 0.0};
+        s_phaseStart[index] = ProfileSeconds();
+    }
+    if (s_openCount < PROFILE_MAX_PHASES) {
+        s_openStack[s_openCount++] = index;
+    }
+}
+
+void EndProfilePhase() {
+    if (s_openCount == 0) return;
+    int index = s_openStack[--s_openCount];
+    if (index >= 0) {
+        s_phases[index].seconds = ProfileSeconds() - s_phaseStart[index];
+    }
+}
+
+int GetProfilePhases(const ProfilePhase*& outPhases) {
+    outPhases = s_phases;
+    return s_phaseCount;
+}
+
+bool IsProfileOverBudget(double budgetMs, double& outTotalMs) {
+    outTotalMs = 0.0;
+    for (int i = 0; i < s_phaseCount; i++) {
+        if (s_phases[i].depth == 0) outTotalMs += s_phases[i].seconds * 1000.0;
+    }
+    return outTotalMs > budgetMs;
+}
+
+void ClearProfilePhases() {
+    s_phaseCount = 0;
+    s_openCount = 0;
+}
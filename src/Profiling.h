@@ -0,0 +1,77 @@
+/**
+ * Profiling - timing helpers for benchmarks and startup profiling
+ *
+ * A monotonic clock and a summary of per-call cost samples (mean and tail
+ * percentiles). Samples are collected into caller-owned vectors that are
+ * reserved up front, so measuring does not allocate inside the timed loop.
+ *
+ * Named phases (e.g. plugin startup steps) are recorded into a fixed table
+ * in the order they start; phases may nest. Sim thread only.
+ */
+
+#pragma once
+
+#include <vector>
+
+constexpr int PROFILE_MAX_PHASES = 32;      // Further phases are not recorded
+
+/**
+ * Cost distribution of one measured operation (microseconds)
+ */
+struct CostSummary {
+    int count = 0;
+    float mean = 0.0f;
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float max = 0.0f;
+};
+
+/**
+ * Monotonic time in seconds (arbitrary origin)
+ */
+double ProfileSeconds();
+
+/**
+ * Summarise cost samples
+ * @param samplesUs - Per-call costs in microseconds; sorted in place
+ */
+CostSummary SummariseCosts(std::vector<float>& samplesUs);
+
+/**
+ * One recorded phase
+ */
+struct ProfilePhase {
+    const char* name;       // Must outlive the table (string literal)
+    int depth;              // Nesting level (0 = top level)
+    double seconds;         // Duration, 0 while still open
+};
+
+/**
+ * Start timing a named phase inside the currently open one (if any)
+ */
+void BeginProfilePhase(const char* name);
+
+/**
+ * Stop timing the innermost open phase
+ */
+void EndProfilePhase();
+
+/**
+ * Recorded phases, in start order
+ * @return Number of phases
+ */
+int GetProfilePhases(const ProfilePhase*& outPhases);
+
+/**
+ * Check the recorded phases against a time budget
+ * Only top-level phases are summed; nested ones are already inside them.
+ * @param outTotalMs - Receives the total in milliseconds
+ * @return true if the total is over the budget
+ */
+bool IsProfileOverBudget(double budgetMs, double& outTotalMs);
+
+/**
+ * Forget all recorded phases
+ */
+void ClearProfilePhases();
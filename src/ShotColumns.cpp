@@ -0,0 +1,144 @@
+/**
+ * ShotColumns - structure-of-arrays copy of a shot library for bulk passes
+ * See ShotColumns.h for an overview.
+ */
+
+#include "ShotColumns.h"
+#include "Arena.h"
+#include "FastMath.h"
+
+#include <algorithm>
+#include <new>
+
+constexpr int FLOAT_COLUMNS = 15;
+constexpr int INT_COLUMNS = 1;
+constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+
+static void FreeColumnBlock(ShotColumns& columns) {
+    if (!columns.arenaBlock) {
+        ::operator delete(columns.block, std::align_val_t(SHOT_COLUMN_ALIGNMENT));
+    }
+}
+
+ShotColumns::~ShotColumns() {
+    FreeColumnBlock(*this);
+}
+
+/**
+ * Grow the storage from the arena if one is given, else from the heap
+ */
+static void GrowShotColumns(ShotColumns& columns, int count, Arena* arena) {
+    columns.count = std::max(count, 0);
+    if (columns.count <= columns.capacity) return;
+
+    int capacity = (columns.count + SHOT_COLUMN_LANES - 1) / SHOT_COLUMN_LANES * SHOT_COLUMN_LANES;
+    // float and unsigned are both 4 bytes, so every column starts 32-byte aligned
+    static_assert(sizeof(float) == 4 && sizeof(unsigned) == 4, "4-byte columns");
+    size_t columnBytes = static_cast<size_t>(capacity) * 4;
+    size_t totalBytes = columnBytes * (FLOAT_COLUMNS + INT_COLUMNS);
+    FreeColumnBlock(columns);
+    if (arena) {
+        columns.block = ArenaAllocate(*arena, totalBytes, SHOT_COLUMN_ALIGNMENT);
+    } else {
+        columns.block = ::operator new(totalBytes, std::align_val_t(SHOT_COLUMN_ALIGNMENT));
+    }
+    columns.arenaBlock = arena != nullptr;
+    columns.capacity = capacity;
+
+    char* base = static_cast<char*>(columns.block);
+    float** floats[FLOAT_COLUMNS] = {
+        &columns.x, &columns.y, &columns.z, &columns.pitch, &columns.heading, &columns.roll,
+        &columns.zoom, &columns.duration, &columns.driftX, &columns.driftY, &columns.driftZ,
+        &columns.driftPitch, &columns.driftHeading, &columns.driftRoll, &columns.driftZoom,
+    };
+    for (int i = 0; i < FLOAT_COLUMNS; i++) {
+        *floats[i] = reinterpret_cast<float*>(base + columnBytes * i);
+    }
+    columns.phaseMask = reinterpret_cast<unsigned*>(base + columnBytes * FLOAT_COLUMNS);
+}
+
+void ResizeShotColumns(ShotColumns& columns, int count) {
+    GrowShotColumns(columns, count, nullptr);
+}
+
+void ResizeShotColumns(ShotColumns& columns, int count, Arena& arena) {
+    GrowShotColumns(columns, count, &arena);
+}
+
+ShotPositions::~ShotPositions() {
+    ::operator delete(block, std::align_val_t(SHOT_COLUMN_ALIGNMENT));
+}
+
+void ResizeShotPositions(ShotPositions& positions, int count) {
+    positions.count = std::max(count, 0);
+    if (positions.count <= positions.capacity) return;
+
+    int capacity = (positions.count + SHOT_COLUMN_LANES - 1) / SHOT_COLUMN_LANES * SHOT_COLUMN_LANES;
+    size_t columnBytes = static_cast<size_t>(capacity) * sizeof(float);
+    ::operator delete(positions.block, std::align_val_t(SHOT_COLUMN_ALIGNMENT));
+    positions.block = ::operator new(columnBytes * 3, std::align_val_t(SHOT_COLUMN_ALIGNMENT));
+    positions.capacity = capacity;
+
+    char* base = static_cast<char*>(positions.block);
+    positions.x = reinterpret_cast<float*>(base);
+    positions.y = reinterpret_cast<float*>(base + columnBytes);
+    positions.z = reinterpret_cast<float*>(base + columnBytes * 2);
+}
+
+int GatherPhaseCandidates(const ShotColumns& columns, unsigned phaseBit, int excludeRow, int* outRows) {
+    const unsigned* mask = columns.phaseMask;
+    int* out = outRows;
+    int found = 0;
+    for (int i = 0; i < columns.count; i++) {
+        // Branch-free compaction: always write, advance only on a match
+        out[found] = i;
+        found += ((mask[i] & phaseBit) != 0) & (i != excludeRow);
+    }
+    return found;
+}
+
+/**
+ * One axis of EvaluateShotPositions
+ * The no-alias promise is made on parameters, where compilers reliably honour it.
+ */
+static void DriftColumn(const float* __restrict start, const float* __restrict drift,
+                        const float* __restrict duration, float* __restrict out, int count,
+                        float elapsed, float driftDistanceScale) {
+    for (int i = 0; i < count; i++) {
+        // drift * duration * scale * min(elapsed / duration, 1) = drift * scale * min(elapsed, duration),
+        // spelled as a select on the loaded value (not std::min) so GCC vectorises it without -ffast-math
+        float shotDuration = duration[i];
+        float t = (shotDuration < elapsed ? shotDuration : elapsed) * driftDistanceScale;
+        out[i] = start[i] + drift[i] * t;
+    }
+}
+
+void EvaluateShotPositions(const ShotColumns& columns, float elapsed, float driftDistanceScale, ShotPositions& out) {
+    ResizeShotPositions(out, columns.count);
+    elapsed = std::max(elapsed, 0.0f);
+    DriftColumn(columns.x, columns.driftX, columns.duration, out.x, columns.count, elapsed, driftDistanceScale);
+    DriftColumn(columns.y, columns.driftY, columns.duration, out.y, columns.count, elapsed, driftDistanceScale);
+    DriftColumn(columns.z, columns.driftZ, columns.duration, out.z, columns.count, elapsed, driftDistanceScale);
+}
+
+void TransformShotPositions(ShotPositions& positions, float acfX, float acfY, float acfZ,
+                            float headingDeg, float pitchDeg, float rollDeg) {
+    float cosH, sinH, cosP, sinP, cosR, sinR;
+    FastSinCos(headingDeg * DEG_TO_RAD, sinH, cosH);
+    FastSinCos(pitchDeg * DEG_TO_RAD, sinP, cosP);
+    FastSinCos(rollDeg * DEG_TO_RAD, sinR, cosR);
+    const int n = positions.count;
+    float* px = positions.x;
+    float* py = positions.y;
+    float* pz = positions.z;
+
+    for (int i = 0; i < n; i++) {
+        float x1 = px[i] * cosH - pz[i] * sinH;
+        float z1 = px[i] * sinH + pz[i] * cosH;
+        float y2 = py[i] * cosP + z1 * sinP;
+        float z2 = -py[i] * sinP + z1 * cosP;
+        px[i] = acfX + x1 * cosR - y2 * sinR;
+        py[i] = acfY + x1 * sinR + y2 * cosR;
+        pz[i] = acfZ + z2;
+    }
+}
@@ -0,0 +1,112 @@
+/**
+ * ShotColumns - structure-of-arrays copy of a shot library for bulk passes
+ *
+ * Shot parameters are held column by column: one float array per field,
+ * 32-byte aligned and padded to a multiple of SHOT_COLUMN_LANES entries.
+ * Passes over the whole library - phase filtering, evaluating every shot at a
+ * given time, moving the results to world space - are then straight loops
+ * over contiguous floats that the compiler vectorises, with no gathers from
+ * 100-byte structs. Names and other per-shot data stay with the shot structs;
+ * row i here is shot i there.
+ *
+ * The columns are read-only to the passes, so a published library can be
+ * shared; positions are evaluated into a ShotPositions the caller owns.
+ * Storage only grows, so rebuilding a library (or re-evaluating into the same
+ * positions) of the same size or smaller does not allocate.
+ */
+
+#pragma once
+
+struct Arena;
+
+constexpr int SHOT_COLUMN_LANES = 8;          // Column padding (8 floats = 32 bytes)
+constexpr int SHOT_COLUMN_ALIGNMENT = 32;     // Byte alignment of every column
+
+struct ShotColumns {
+    int count = 0;              // Shots in the library
+    int capacity = 0;           // Allocated rows (multiple of SHOT_COLUMN_LANES)
+
+    // Start pose (aircraft coordinates, degrees) and drift per second
+    float* x = nullptr;
+    float* y = nullptr;
+    float* z = nullptr;
+    float* pitch = nullptr;
+    float* heading = nullptr;
+    float* roll = nullptr;
+    float* zoom = nullptr;
+    float* duration = nullptr;
+    float* driftX = nullptr;
+    float* driftY = nullptr;
+    float* driftZ = nullptr;
+    float* driftPitch = nullptr;
+    float* driftHeading = nullptr;
+    float* driftRoll = nullptr;
+    float* driftZoom = nullptr;
+    unsigned* phaseMask = nullptr;
+
+    void* block = nullptr;      // Single aligned allocation behind all columns
+    bool arenaBlock = false;    // block belongs to an arena, which frees it
+
+    ShotColumns() = default;
+    ShotColumns(const ShotColumns&) = delete;
+    ShotColumns& operator=(const ShotColumns&) = delete;
+    ~ShotColumns();
+};
+
+/**
+ * Camera position of every row of a library, as evaluated by the bulk passes
+ * Same layout as ShotColumns; row i is row i of the library it was evaluated from.
+ */
+struct ShotPositions {
+    int count = 0;
+    int capacity = 0;
+    float* x = nullptr;
+    float* y = nullptr;
+    float* z = nullptr;
+    void* block = nullptr;
+
+    ShotPositions() = default;
+    ShotPositions(const ShotPositions&) = delete;
+    ShotPositions& operator=(const ShotPositions&) = delete;
+    ~ShotPositions();
+};
+
+/**
+ * Set the row count, growing the storage if needed
+ * Column contents are undefined afterwards; the caller fills every row.
+ */
+void ResizeShotColumns(ShotColumns& columns, int count);
+
+/**
+ * Set the row count, taking new storage from an arena
+ * The columns must not outlive the arena, which frees the storage.
+ */
+void ResizeShotColumns(ShotColumns& columns, int count, Arena& arena);
+
+/**
+ * Set the row count of a positions buffer, growing the storage if needed
+ */
+void ResizeShotPositions(ShotPositions& positions, int count);
+
+/**
+ * Collect the rows whose phase mask contains phaseBit
+ * @param excludeRow - Row to leave out (e.g. the current shot), -1 for none
+ * @param outRows - Receives the row indices; room for columns.count entries
+ * @return Number of candidates
+ */
+int GatherPhaseCandidates(const ShotColumns& columns, unsigned phaseBit, int excludeRow, int* outRows);
+
+/**
+ * Evaluate the drifted camera position of every shot at a time
+ * Same model as a single shot's drift: position = start + drift * duration *
+ * driftDistanceScale * clamp(elapsed / duration). Results are in aircraft
+ * coordinates; out is resized to the library.
+ */
+void EvaluateShotPositions(const ShotColumns& columns, float elapsed, float driftDistanceScale, ShotPositions& out);
+
+/**
+ * Rotate positions by an aircraft attitude and add its position (in place)
+ * Heading, then pitch, then roll - the same order as single-shot evaluation.
+ */
+void TransformShotPositions(ShotPositions& positions, float acfX, float acfY, float acfZ,
+                            float headingDeg, float pitchDeg, float rollDeg);
@@ -0,0 +1,284 @@
+/**
+ * TrafficTracker - batched access to AI and multiplayer traffic
+ * See TrafficTracker.h for an overview.
+ */
+
+#include "TrafficTracker.h"
+
+#include "XPLMDataAccess.h"
+
+#include <cmath>
+#include <algorithm>
+
+// Runway inference for QueryTrafficSameRunway
+constexpr float RUNWAY_HALF_LENGTH = 2000.0f;       // Corridor reach either side of the aircraft (meters)
+constexpr float RUNWAY_HALF_WIDTH = 45.0f;          // Corridor half width (meters)
+constexpr float RUNWAY_MAX_HEADING_DIFF = 15.0f;    // Max misalignment with the runway (degrees)
+constexpr float DEG_TO_RAD = 3.14159265359f / 180.0f;
+
+// TCAS target datarefs (all arrays of TRAFFIC_MAX_TARGETS)
+static XPLMDataRef s_drNumTargets = nullptr;
+static XPLMDataRef s_drX = nullptr;
+static XPLMDataRef s_drY = nullptr;
+static XPLMDataRef s_drZ = nullptr;
+static XPLMDataRef s_drHeading = nullptr;
+static XPLMDataRef s_drPitch = nullptr;
+static XPLMDataRef s_drRoll = nullptr;
+static XPLMDataRef s_drVx = nullptr;
+static XPLMDataRef s_drVy = nullptr;
+static XPLMDataRef s_drVz = nullptr;
+static XPLMDataRef s_drModeS = nullptr;
+static XPLMDataRef s_drOnGround = nullptr;
+static XPLMDataRef s_drFlightId = nullptr;
+static XPLMDataRef s_drIcaoType = nullptr;
+static XPLMDataRef s_drOverrideTcas = nullptr;
+
+bool InitTraffic() {
+    s_drNumTargets = XPLMFindDataRef("sim/cockpit2/tcas/indicators/tcas_num_acf");
+    s_drX = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/x");
+    s_drY = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/y");
+    s_drZ = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/z");
+    s_drHeading = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/psi");
+    s_drPitch = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/the");
+    s_drRoll = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/phi");
+    s_drVx = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/vx");
+    s_drVy = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/vy");
+    s_drVz = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/vz");
+    s_drModeS = XPLMFindDataRef("sim/cockpit2/tcas/targets/modeS_id");
+    s_drOnGround = XPLMFindDataRef("sim/cockpit2/tcas/targets/position/weight_on_wheels");
+    s_drFlightId = XPLMFindDataRef("sim/cockpit2/tcas/targets/flight_id");
+    s_drIcaoType = XPLMFindDataRef("sim/cockpit2/tcas/targets/icao_type");
+    s_drOverrideTcas = XPLMFindDataRef("sim/operation/override/override_TCAS");
+
+    return s_drNumTargets && s_drX && s_drY && s_drZ && s_drHeading && s_drPitch && s_drRoll && s_drModeS;
+}
+
+/**
+ * Read one float array, zero-filling whatever the sim did not provide
+ */
+static void ReadFloatArray(XPLMDataRef ref, float* out, int count) {
+    int got = ref ? XPLMGetDatavf(ref, out, 0, count) : 0;
+    std::fill(out + std::max(got, 0), out + count, 0.0f);
+}
+
+static void ReadIntArray(XPLMDataRef ref, int* out, int count) {
+    int got = ref ? XPLMGetDatavi(ref, out, 0, count) : 0;
+    std::fill(out + std::max(got, 0), out + count, 0);
+}
+
+void ReadTraffic(TrafficSnapshot& snapshot, bool withIdentity) {
+    int count = s_drNumTargets ? XPLMGetDatai(s_drNumTargets) : 0;
+    snapshot.count = std::clamp(count, 0, TRAFFIC_MAX_TARGETS);
+    if (snapshot.count == 0) return;
+
+    int n = snapshot.count;
+    ReadFloatArray(s_drX, snapshot.x, n);
+    ReadFloatArray(s_drY, snapshot.y, n);
+    ReadFloatArray(s_drZ, snapshot.z, n);
+    ReadFloatArray(s_drHeading, snapshot.heading, n);
+    ReadFloatArray(s_drPitch, snapshot.pitch, n);
+    ReadFloatArray(s_drRoll, snapshot.roll, n);
+    ReadFloatArray(s_drVx, snapshot.vx, n);
+    ReadFloatArray(s_drVy, snapshot.vy, n);
+    ReadFloatArray(s_drVz, snapshot.vz, n);
+    ReadIntArray(s_drModeS, snapshot.modeS, n);
+    ReadIntArray(s_drOnGround, snapshot.onGround, n);
+
+    // Distances from the user aircraft (slot 0) - a branch-free loop over
+    // contiguous arrays that the compiler vectorises
+    const float userX = snapshot.x[0], userY = snapshot.y[0], userZ = snapshot.z[0];
+    for (int i = 0; i < n; i++) {
+        float dx = snapshot.x[i] - userX;
+        float dy = snapshot.y[i] - userY;
+        float dz = snapshot.z[i] - userZ;
+        snapshot.distance[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    if (withIdentity) {
+        char* flightIds = &snapshot.flightId[0][0];
+        char* icaoTypes = &snapshot.icaoType[0][0];
+        int bytes = n * TRAFFIC_ID_LENGTH;
+        int gotIds = s_drFlightId ? XPLMGetDatab(s_drFlightId, flightIds, 0, bytes) : 0;
+        int gotTypes = s_drIcaoType ? XPLMGetDatab(s_drIcaoType, icaoTypes, 0, bytes) : 0;
+        std::fill(flightIds + std::max(gotIds, 0), flightIds + bytes, '\0');
+        std::fill(icaoTypes + std::max(gotTypes, 0), icaoTypes + bytes, '\0');
+        // The sim terminates each entry, but never trust a fixed-width field
+        for (int i = 0; i < n; i++) {
+            snapshot.flightId[i][TRAFFIC_ID_LENGTH - 1] = '\0';
+            snapshot.icaoType[i][TRAFFIC_ID_LENGTH - 1] = '\0';
+        }
+    }
+}
+
+bool TrafficSlotsAreAircraftIndices() {
+    return !(s_drOverrideTcas && XPLMGetDatai(s_drOverrideTcas));
+}
+
+int FindTrafficSlot(const TrafficSnapshot& snapshot, int modeS) {
+    if (modeS == 0) return -1;
+    for (int i = 1; i < snapshot.count; i++) {
+        if (snapshot.modeS[i] == modeS) return i;
+    }
+    return -1;
+}
+
+/**
+ * Cell coordinate of a horizontal position
+ */
+static int CellOf(float v) {
+    return static_cast<int>(std::floor(v / TRAFFIC_CELL_SIZE));
+}
+
+static int BucketOf(int cellX, int cellZ) {
+    unsigned h = static_cast<unsigned>(cellX) * 73856093u ^ static_cast<unsigned>(cellZ) * 19349663u;
+    return static_cast<int>(h & (TRAFFIC_HASH_BUCKETS - 1));
+}
+
+void BuildTrafficGrid(const TrafficSnapshot& snapshot, TrafficGrid& grid) {
+    int counts[TRAFFIC_HASH_BUCKETS + 1] = {};
+    int buckets[TRAFFIC_MAX_TARGETS];
+
+    for (int i = 0; i < snapshot.count; i++) {
+        grid.cellX[i] = CellOf(snapshot.x[i]);
+        grid.cellZ[i] = CellOf(snapshot.z[i]);
+        // Slot 0 (the user) has no mode-S in some sessions but is always valid
+        buckets[i] = (snapshot.modeS[i] != 0 || i == 0) ? BucketOf(grid.cellX[i], grid.cellZ[i]) : -1;
+        if (buckets[i] >= 0) counts[buckets[i] + 1]++;
+    }
+
+    grid.bucketStart[0] = 0;
+    for (int b = 0; b < TRAFFIC_HASH_BUCKETS; b++) {
+        grid.bucketStart[b + 1] = grid.bucketStart[b] + counts[b + 1];
+        counts[b + 1] = grid.bucketStart[b];    // Reuse as the fill cursor
+    }
+    for (int i = 0; i < snapshot.count; i++) {
+        if (buckets[i] >= 0) grid.sortedSlots[counts[buckets[i] + 1]++] = i;
+    }
+}
+
+/**
+ * Visit every slot in one cell
+ */
+template <typename Visitor>
+static void ForEachInCell(const TrafficGrid& grid, int cellX, int cellZ, Visitor&& visit) {
+    int bucket = BucketOf(cellX, cellZ);
+    for (int k = grid.bucketStart[bucket]; k < grid.bucketStart[bucket + 1]; k++) {
+        int slot = grid.sortedSlots[k];
+        if (grid.cellX[slot] == cellX && grid.cellZ[slot] == cellZ) visit(slot);
+    }
+}
+
+int QueryNearestTraffic(const TrafficSnapshot& snapshot, const TrafficGrid& grid,
+                        float x, float y, float z, float maxRange, int excludeSlot,
+                        int maxCount, int* outSlots) {
+    if (maxCount <= 0) return 0;
+    maxCount = std::min(maxCount, TRAFFIC_MAX_TARGETS);
+    float bestDist[TRAFFIC_MAX_TARGETS];
+    int found = 0;
+    int centerX = CellOf(x), centerZ = CellOf(z);
+    int maxRing = static_cast<int>(std::ceil(maxRange / TRAFFIC_CELL_SIZE));
+
+    auto consider = [&](int slot) {
+        if (slot == excludeSlot) return;
+        float dx = snapshot.x[slot] - x, dy = snapshot.y[slot] - y, dz = snapshot.z[slot] - z;
+        float d = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (d > maxRange || (found == maxCount && d >= bestDist[found - 1])) return;
+        // Insertion into the short sorted result list
+        int pos = (found < maxCount) ? found++ : found - 1;
+        while (pos > 0 && bestDist[pos - 1] > d) {
+            bestDist[pos] = bestDist[pos - 1];
+            outSlots[pos] = outSlots[pos - 1];
+            pos--;
+        }
+        bestDist[pos] = d;
+        outSlots[pos] = slot;
+    };
+
+    // Walk square rings of cells outwards. Anything outside ring r is at least
+    // r cells away horizontally, so stop once the result list can't improve.
+    // A long range would visit thousands of mostly empty cells, so once the
+    // cells walked would outnumber the indexed slots, scan the slots instead.
+    int indexed = grid.bucketStart[TRAFFIC_HASH_BUCKETS];
+    for (int r = 0; r <= maxRing; r++) {
+        if ((2 * r + 1) * (2 * r + 1) > indexed) {
+            found = 0;
+            for (int k = 0; k < indexed; k++) {
+                consider(grid.sortedSlots[k]);
+            }
+            break;
+        }
+        for (int cz = centerZ - r; cz <= centerZ + r; cz++) {
+            bool edgeRow = (cz == centerZ - r || cz == centerZ + r);
+            int step = edgeRow ? 1 : 2 * r;
+            for (int cx = centerX - r; cx <= centerX + r; cx += std::max(step, 1)) {
+                ForEachInCell(grid, cx, cz, consider);
+            }
+        }
+        if (found == maxCount && bestDist[found - 1] <= r * TRAFFIC_CELL_SIZE) break;
+    }
+    return found;
+}
+
+int QueryTrafficNearSegment(const TrafficSnapshot& snapshot, const TrafficGrid& grid,
+                            float ax, float ay, float az, float bx, float by, float bz,
+                            float radius, int excludeSlot, int maxCount, int* outSlots) {
+    bool seen[TRAFFIC_MAX_TARGETS] = {};
+    int found = 0;
+    float sx = bx - ax, sy = by - ay, sz = bz - az;
+    float lengthSq = sx * sx + sy * sy + sz * sz;
+    float radiusSq = radius * radius;
+
+    auto consider = [&](int slot) {
+        if (slot == excludeSlot || seen[slot] || found >= maxCount) return;
+        seen[slot] = true;
+        float px = snapshot.x[slot] - ax, py = snapshot.y[slot] - ay, pz = snapshot.z[slot] - az;
+        float t = (lengthSq > 0.0f) ? std::clamp((px * sx + py * sy + pz * sz) / lengthSq, 0.0f, 1.0f) : 0.0f;
+        float dx = px - sx * t, dy = py - sy * t, dz = pz - sz * t;
+        if (dx * dx + dy * dy + dz * dz <= radiusSq) outSlots[found++] = slot;
+    };
+
+    // Sample the segment once per cell and visit the 3x3 block around each
+    // sample; with radius <= cell size that covers the whole capsule
+    float horizontal = std::sqrt(sx * sx + sz * sz);
+    int steps = std::max(1, static_cast<int>(std::ceil(horizontal / TRAFFIC_CELL_SIZE)));
+    int lastX = 0, lastZ = 0;
+    for (int s = 0; s <= steps; s++) {
+        float t = static_cast<float>(s) / steps;
+        int cellX = CellOf(ax + sx * t), cellZ = CellOf(az + sz * t);
+        if (s > 0 && cellX == lastX && cellZ == lastZ) continue;
+        lastX = cellX;
+        lastZ = cellZ;
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                ForEachInCell(grid, cellX + dx, cellZ + dz, consider);
+            }
+        }
+    }
+    return found;
+}
+
+int QueryTrafficSameRunway(const TrafficSnapshot& snapshot, const TrafficGrid& grid,
+                           int slot, int maxCount, int* outSlots) {
+    if (slot < 0 || slot >= snapshot.count || !snapshot.onGround[slot]) return 0;
+
+    // Heading 0 is north (-Z), 90 is east (+X)
+    float h = snapshot.heading[slot] * DEG_TO_RAD;
+    float dirX = std::sin(h), dirZ = -std::cos(h);
+    float x = snapshot.x[slot], y = snapshot.y[slot], z = snapshot.z[slot];
+
+    int corridor[TRAFFIC_MAX_TARGETS];
+    int count = QueryTrafficNearSegment(snapshot, grid,
+                                        x - dirX * RUNWAY_HALF_LENGTH, y, z - dirZ * RUNWAY_HALF_LENGTH,
+                                        x + dirX * RUNWAY_HALF_LENGTH, y, z + dirZ * RUNWAY_HALF_LENGTH,
+                                        RUNWAY_HALF_WIDTH, slot, TRAFFIC_MAX_TARGETS, corridor);
+    int found = 0;
+    for (int k = 0; k < count && found < maxCount; k++) {
+        int other = corridor[k];
+        if (!snapshot.onGround[other]) continue;
+        float diff = std::fmod(std::fabs(snapshot.heading[other] - snapshot.heading[slot]), 180.0f);
+        if (diff < RUNWAY_MAX_HEADING_DIFF || diff > 180.0f - RUNWAY_MAX_HEADING_DIFF) {
+            outSlots[found++] = other;
+        }
+    }
+    return found;
+}
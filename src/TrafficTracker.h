@@ -0,0 +1,119 @@
+/**
+ * TrafficTracker - batched access to AI and multiplayer traffic
+ *
+ * Reads the TCAS target arrays (sim/cockpit2/tcas/targets/...) with one
+ * XPLMGetDatav call per array, so the cost per frame is a fixed number of
+ * dataref calls no matter how many targets are present. The data is kept as
+ * structure-of-arrays, indexed by TCAS slot. Slot 0 is always the user
+ * aircraft; traffic starts at slot 1.
+ *
+ * A uniform-grid spatial hash over the snapshot answers neighbour queries
+ * (nearest N, near a camera ray, same runway) by visiting only nearby cells.
+ */
+
+#pragma once
+
+constexpr int TRAFFIC_MAX_TARGETS = 64;      // Size of the TCAS target arrays
+constexpr int TRAFFIC_ID_LENGTH = 8;         // Flight ID / ICAO type length incl. terminator
+constexpr float TRAFFIC_CELL_SIZE = 250.0f;  // Spatial hash cell edge (meters, horizontal)
+constexpr int TRAFFIC_HASH_BUCKETS = 256;    // Power of two, well above the target count
+
+/**
+ * One frame of traffic state (structure-of-arrays, indexed by TCAS slot)
+ */
+struct TrafficSnapshot {
+    int count = 0;                                      // Slots in use, including the user at slot 0
+    float x[TRAFFIC_MAX_TARGETS];                       // Local OpenGL position (meters)
+    float y[TRAFFIC_MAX_TARGETS];
+    float z[TRAFFIC_MAX_TARGETS];
+    float heading[TRAFFIC_MAX_TARGETS];                 // True heading (degrees)
+    float pitch[TRAFFIC_MAX_TARGETS];                   // Degrees
+    float roll[TRAFFIC_MAX_TARGETS];                    // Degrees
+    float vx[TRAFFIC_MAX_TARGETS];                      // Local velocity (m/s)
+    float vy[TRAFFIC_MAX_TARGETS];
+    float vz[TRAFFIC_MAX_TARGETS];
+    float distance[TRAFFIC_MAX_TARGETS];                // Distance from the user aircraft (meters)
+    int modeS[TRAFFIC_MAX_TARGETS];                     // Unique airframe ID (0 = empty slot)
+    int onGround[TRAFFIC_MAX_TARGETS];                  // Weight on wheels
+    char flightId[TRAFFIC_MAX_TARGETS][TRAFFIC_ID_LENGTH];
+    char icaoType[TRAFFIC_MAX_TARGETS][TRAFFIC_ID_LENGTH];
+};
+
+/**
+ * Find the TCAS datarefs
+ * @return false if this X-Plane version does not publish TCAS targets
+ */
+bool InitTraffic();
+
+/**
+ * Read all targets into a snapshot
+ * @param snapshot - Receives the traffic state
+ * @param withIdentity - Also read flight IDs and ICAO types (string arrays, only needed for display)
+ */
+void ReadTraffic(TrafficSnapshot& snapshot, bool withIdentity);
+
+/**
+ * Whether TCAS slot N is X-Plane's aircraft index N
+ * True for X-Plane's own AI; false while a plugin overrides TCAS (multiplayer
+ * clients write their own targets there, which have no X-Plane model).
+ */
+bool TrafficSlotsAreAircraftIndices();
+
+/**
+ * Find the slot of an airframe by its mode-S ID
+ * Slots can be reassigned when traffic comes and goes, so targets are tracked by ID.
+ * @return Slot index, or -1 if the airframe is not in the snapshot
+ */
+int FindTrafficSlot(const TrafficSnapshot& snapshot, int modeS);
+
+/**
+ * Uniform-grid spatial hash of a traffic snapshot (horizontal plane)
+ * Cells are hashed into a fixed bucket table and the slots are counting-sorted
+ * by bucket, so a rebuild is one linear pass with no allocations. Buckets can
+ * hold slots from several cells; queries check the exact cell.
+ */
+struct TrafficGrid {
+    int bucketStart[TRAFFIC_HASH_BUCKETS + 1];    // Range of each bucket in sortedSlots
+    int sortedSlots[TRAFFIC_MAX_TARGETS];         // Slots ordered by bucket
+    int cellX[TRAFFIC_MAX_TARGETS];               // Cell of each slot
+    int cellZ[TRAFFIC_MAX_TARGETS];
+};
+
+/**
+ * Rebuild the spatial hash from a snapshot (slots with mode-S 0 are left out)
+ */
+void BuildTrafficGrid(const TrafficSnapshot& snapshot, TrafficGrid& grid);
+
+/**
+ * Find the traffic nearest to a point
+ * @param x, y, z - Query point (local coordinates)
+ * @param maxRange - Ignore traffic further away (meters)
+ * @param excludeSlot - Slot to skip (e.g. the subject itself), -1 for none
+ * @param outSlots - Receives up to maxCount slots, nearest first
+ * @return Number of slots found
+ */
+int QueryNearestTraffic(const TrafficSnapshot& snapshot, const TrafficGrid& grid,
+                        float x, float y, float z, float maxRange, int excludeSlot,
+                        int maxCount, int* outSlots);
+
+/**
+ * Find traffic within a distance of a segment, e.g. the camera's line of sight
+ * @param ax, ay, az - Segment start (e.g. camera position)
+ * @param bx, by, bz - Segment end (e.g. the subject)
+ * @param radius - Max distance from the segment (meters, at most TRAFFIC_CELL_SIZE)
+ * @param excludeSlot - Slot to skip, -1 for none
+ * @return Number of slots written to outSlots
+ */
+int QueryTrafficNearSegment(const TrafficSnapshot& snapshot, const TrafficGrid& grid,
+                            float ax, float ay, float az, float bx, float by, float bz,
+                            float radius, int excludeSlot, int maxCount, int* outSlots);
+
+/**
+ * Find aircraft that appear to share a runway with a slot
+ * There is no runway database here, so a runway is inferred: aircraft on the
+ * ground, inside a long narrow corridor along the slot's heading, and lined up
+ * with it (same or reciprocal heading).
+ * @return Number of slots written to outSlots (excluding the slot itself)
+ */
+int QueryTrafficSameRunway(const TrafficSnapshot& snapshot, const TrafficGrid& grid,
+                           int slot, int maxCount, int* outSlots);
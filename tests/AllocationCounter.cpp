@@ -0,0 +1,100 @@
+/**
+ * AllocationCounter - heap use of a test program
+ * See AllocationCounter.h for an overview.
+ */
+
+#include "AllocationCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if IBM
+#include <malloc.h>
+#elif APL
+#include <malloc/malloc.h>
+#else
+#include <malloc.h>
+#endif
+
+static std::atomic<long long> s_allocations{0};
+static std::atomic<long long> s_liveBytes{0};
+static std::atomic<long long> s_peakBytes{0};
+
+AllocationStats GetAllocationStats() {
+    AllocationStats stats;
+    stats.allocations = s_allocations.load(std::memory_order_relaxed);
+    stats.liveBytes = s_liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = s_peakBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ResetAllocationPeak() {
+    s_peakBytes.store(s_liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+/**
+ * Usable size of a block from malloc (or _aligned_malloc on Windows)
+ */
+static size_t BlockSize(void* block, size_t alignment) {
+#if IBM
+    return alignment ? _aligned_msize(block, alignment, 0) : _msize(block);
+#elif APL
+    (void)alignment;
+    return malloc_size(block);
+#else
+    (void)alignment;
+    return malloc_usable_size(block);
+#endif
+}
+
+static void* CountedAllocate(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+    void* block = nullptr;
+#if IBM
+    block = alignment ? _aligned_malloc(size, alignment) : std::malloc(size);
+#else
+    if (alignment) {
+        if (posix_memalign(&block, std::max(alignment, sizeof(void*)), size) != 0) block = nullptr;
+    } else {
+        block = std::malloc(size);
+    }
+#endif
+    if (!block) throw std::bad_alloc();
+
+    long long bytes = static_cast<long long>(BlockSize(block, alignment));
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    long long live = s_liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    long long peak = s_peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !s_peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    return block;
+}
+
+static void CountedFree(void* block, size_t alignment) {
+    if (!block) return;
+    s_liveBytes.fetch_sub(static_cast<long long>(BlockSize(block, alignment)), std::memory_order_relaxed);
+#if IBM
+    if (alignment) {
+        _aligned_free(block);
+        return;
+    }
+#endif
+    std::free(block);
+}
+
+// Replacements for every form of the global operator new and delete; the
+// nothrow forms are left to the library, which calls these
+void* operator new(size_t size) { return CountedAllocate(size, 0); }
+void* operator new[](size_t size) { return CountedAllocate(size, 0); }
+void* operator new(size_t size, std::align_val_t alignment) { return CountedAllocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](size_t size, std::align_val_t alignment) { return CountedAllocate(size, static_cast<size_t>(alignment)); }
+void operator delete(void* block) noexcept { CountedFree(block, 0); }
+void operator delete[](void* block) noexcept { CountedFree(block, 0); }
+void operator delete(void* block, size_t) noexcept { CountedFree(block, 0); }
+void operator delete[](void* block, size_t) noexcept { CountedFree(block, 0); }
+void operator delete(void* block, std::align_val_t alignment) noexcept { CountedFree(block, static_cast<size_t>(alignment)); }
+void operator delete[](void* block, std::align_val_t alignment) noexcept { CountedFree(block, static_cast<size_t>(alignment)); }
+void operator delete(void* block, size_t, std::align_val_t alignment) noexcept { CountedFree(block, static_cast<size_t>(alignment)); }
+void operator delete[](void* block, size_t, std::align_val_t alignment) noexcept { CountedFree(block, static_cast<size_t>(alignment)); }
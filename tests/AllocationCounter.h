@@ -0,0 +1,27 @@
+/**
+ * AllocationCounter - heap use of a test program
+ *
+ * Linking AllocationCounter.cpp replaces the program's global operator new
+ * and delete to count heap allocations and track live and peak heap bytes
+ * (any thread, relaxed atomics). Sizes are the allocator's usable sizes, so
+ * they include its rounding. Only linked into test programs: the plugin keeps
+ * the host's allocator.
+ */
+
+#pragma once
+
+/**
+ * Heap use through operator new since the program started
+ */
+struct AllocationStats {
+    long long allocations = 0;  // Calls to operator new
+    long long liveBytes = 0;    // Allocated and not yet freed
+    long long peakBytes = 0;    // Highest liveBytes since start or the last ResetAllocationPeak
+};
+
+AllocationStats GetAllocationStats();
+
+/**
+ * Start a new high-water mark from the current live bytes
+ */
+void ResetAllocationPeak();
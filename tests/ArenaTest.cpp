@@ -0,0 +1,116 @@
+/**
+ * ArenaTest - bump allocation, one-step release and chunk recycling
+ */
+
+#include "Arena.h"
+#include "ShotColumns.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static int s_failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                       \
+        }                                                                       \
+    } while (0)
+
+static bool IsAligned(const void* p, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+
+/**
+ * Allocations are aligned, distinct, and accounted for
+ */
+static void TestAllocate() {
+    Arena arena;
+    char* a = static_cast<char*>(ArenaAllocate(arena, 3, 1));
+    double* b = static_cast<double*>(ArenaAllocate(arena, sizeof(double) * 4, alignof(double)));
+    void* c = ArenaAllocate(arena, 100, ARENA_MAX_ALIGNMENT);
+    CHECK(IsAligned(b, alignof(double)));
+    CHECK(IsAligned(c, ARENA_MAX_ALIGNMENT));
+    CHECK(reinterpret_cast<char*>(b) >= a + 3);
+    CHECK(static_cast<char*>(c) >= reinterpret_cast<char*>(b + 4));
+
+    ArenaStats stats = GetArenaStats(arena);
+    CHECK(stats.chunks == 1);
+    CHECK(stats.usedBytes >= 3 + sizeof(double) * 4 + 100);
+    CHECK(stats.reservedBytes == ARENA_CHUNK_BYTES);
+
+    // Filling past a chunk takes another; an oversized request gets its own block
+    ArenaAllocate(arena, ARENA_CHUNK_BYTES - 16, 1);
+    void* big = ArenaAllocate(arena, ARENA_CHUNK_BYTES * 3, 16);
+    std::memset(big, 0xAB, ARENA_CHUNK_BYTES * 3);
+    stats = GetArenaStats(arena);
+    CHECK(stats.chunks == 3);
+    CHECK(stats.reservedBytes == ARENA_CHUNK_BYTES * 5);
+    CHECK(stats.peakBytes == stats.usedBytes);
+
+    const char* text = ArenaCopyString(arena, "Pedestal View");
+    CHECK(std::strcmp(text, "Pedestal View") == 0);
+
+    ResetArena(arena);
+    stats = GetArenaStats(arena);
+    CHECK(stats.usedBytes == 0 && stats.chunks == 0);
+    CHECK(stats.peakBytes >= ARENA_CHUNK_BYTES * 4);
+}
+
+/**
+ * Released chunks are reused by the next arena instead of coming from the heap
+ */
+static void TestRecycling() {
+    ReleaseArenaPool();
+    void* first;
+    {
+        Arena arena;
+        first = ArenaAllocate(arena, 64, 8);
+    }
+    CHECK(GetArenaPoolBytes() == ARENA_CHUNK_BYTES);
+    Arena next;
+    void* second = ArenaAllocate(next, 64, 8);
+    CHECK(second == first);
+    CHECK(GetArenaPoolBytes() == 0);
+    ResetArena(next);
+    CHECK(GetArenaPoolBytes() == ARENA_CHUNK_BYTES);
+    ReleaseArenaPool();
+    CHECK(GetArenaPoolBytes() == 0);
+}
+
+/**
+ * Containers and shot columns can live in an arena
+ */
+static void TestContainers() {
+    Arena arena;
+    std::vector<int, ArenaAllocator<int>> values{ArenaAllocator<int>(&arena)};
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(i);
+    }
+    CHECK(values.size() == 1000 && values[999] == 999);
+    CHECK(GetArenaStats(arena).usedBytes >= sizeof(int) * 1000);
+
+    ShotColumns columns;
+    ResizeShotColumns(columns, 37, arena);
+    CHECK(columns.arenaBlock);
+    CHECK(columns.capacity == 40);
+    CHECK(IsAligned(columns.x, SHOT_COLUMN_ALIGNMENT) && IsAligned(columns.phaseMask, SHOT_COLUMN_ALIGNMENT));
+    columns.phaseMask[36] = 1u;
+    CHECK(columns.phaseMask[36] == 1u);
+}
+
+int main() {
+    TestAllocate();
+    TestRecycling();
+    TestContainers();
+    ReleaseArenaPool();
+    if (s_failures > 0) {
+        std::printf("ArenaTest: %d checks failed\n", s_failures);
+        return 1;
+    }
+    std::printf("ArenaTest: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * FastMathTest - the approximations stay within their documented bounds
+ * Dense sweeps plus the edge cases a uniform sweep can step over.
+ */
+
+#include "FastMath.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+
+constexpr int SWEEP_SAMPLES = 2000000;
+
+static int s_failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                       \
+        }                                                                       \
+    } while (0)
+
+/**
+ * A dense sweep of every function against its bound
+ */
+static void TestSweep() {
+    FastMathErrors errors = MeasureFastMathErrors(SWEEP_SAMPLES);
+    std::printf("FastMathTest: sincos %.3g (bound %.3g), atan2 %.3g (%.3g), rsqrt %.3g (%.3g)\n",
+                errors.sinCos, FAST_SINCOS_MAX_ERROR, errors.atan2, FAST_ATAN2_MAX_ERROR,
+                errors.rsqrt, FAST_RSQRT_MAX_ERROR);
+    CHECK(errors.sinCos <= FAST_SINCOS_MAX_ERROR);
+    CHECK(errors.atan2 <= FAST_ATAN2_MAX_ERROR);
+    CHECK(errors.rsqrt <= FAST_RSQRT_MAX_ERROR);
+}
+
+static void CheckSinCos(float radians) {
+    float s, c;
+    FastSinCos(radians, s, c);
+    CHECK(std::fabs(s - std::sin(static_cast<double>(radians))) <= FAST_SINCOS_MAX_ERROR);
+    CHECK(std::fabs(c - std::cos(static_cast<double>(radians))) <= FAST_SINCOS_MAX_ERROR);
+}
+
+static void CheckAtan2(float y, float x) {
+    double error = std::fabs(FastAtan2(y, x) - std::atan2(static_cast<double>(y), static_cast<double>(x)));
+    error = std::fmin(error, 6.28318530717959 - error);     // -pi and pi are the same direction
+    CHECK(error <= FAST_ATAN2_MAX_ERROR);
+}
+
+static void CheckRsqrt(float x) {
+    double ref = 1.0 / std::sqrt(static_cast<double>(x));
+    CHECK(std::fabs(FastRsqrt(x) - ref) / ref <= FAST_RSQRT_MAX_ERROR);
+}
+
+/**
+ * Quadrant boundaries, the ends of the supported range and extreme magnitudes
+ */
+static void TestEdgeCases() {
+    const float pi = 3.14159265358979f;
+    const float angles[] = {0.0f, -0.0f, pi * 0.25f, pi * 0.5f, pi, -pi, 1.5f * pi, 2.0f * pi,
+                            FAST_SINCOS_RANGE, -FAST_SINCOS_RANGE, std::nextafter(FAST_SINCOS_RANGE, 0.0f)};
+    for (float angle : angles) {
+        CheckSinCos(angle);
+    }
+
+    const float magnitudes[] = {FLT_MIN, 1e-20f, 1e-3f, 1.0f, 1e3f, 1e20f, FLT_MAX};
+    for (float m : magnitudes) {
+        CheckAtan2(0.0f, m);
+        CheckAtan2(m, 0.0f);
+        CheckAtan2(0.0f, -m);
+        CheckAtan2(-m, 0.0f);
+        CheckAtan2(-0.0f, -m);
+        CheckAtan2(m, m);
+        CheckAtan2(-m, -m);
+        CheckAtan2(m, -m * 0.5f);
+    }
+    CHECK(FastAtan2(0.0f, 0.0f) == 0.0f);
+
+    const float values[] = {FLT_MIN, 1e-30f, 0.25f, 0.5f, 1.0f, 2.0f, 3.0f, 4.0f, 1e30f, FLT_MAX};
+    for (float v : values) {
+        CheckRsqrt(v);
+        CheckRsqrt(std::nextafter(v, 1.0f));     // Mantissa neighbours of the powers of two
+    }
+}
+
+int main() {
+    TestSweep();
+    TestEdgeCases();
+    if (s_failures > 0) {
+        std::printf("FastMathTest: %d checks failed\n", s_failures);
+        return 1;
+    }
+    std::printf("FastMathTest: all checks passed\n");
+    return 0;
+}
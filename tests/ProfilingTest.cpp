@@ -0,0 +1,103 @@
+/**
+ * ProfilingTest - startup phase recording and the budget check
+ * Links only Profiling.cpp, so it runs without X-Plane.
+ */
+
+#include "Profiling.h"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+static int s_failures = 0;
+
+#define CHECK(condition)                                                        \
+    do {                                                                        \
+        if (!(condition)) {                                                     \
+            std::printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            s_failures++;                                                       \
+        }                                                                       \
+    } while (0)
+
+static void SleepMs(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/**
+ * Nested phases are inside their parent and must not be counted twice
+ */
+static void TestNestedPhasesCountedOnce() {
+    ClearProfilePhases();
+    BeginProfilePhase("Outer");
+    SleepMs(20);
+    BeginProfilePhase("Inner");
+    SleepMs(20);
+    EndProfilePhase();
+    EndProfilePhase();
+    BeginProfilePhase("Second");
+    SleepMs(5);
+    EndProfilePhase();
+
+    const ProfilePhase* phases = nullptr;
+    CHECK(GetProfilePhases(phases) == 3);
+    CHECK(phases[0].depth == 0 && phases[1].depth == 1 && phases[2].depth == 0);
+    CHECK(phases[1].seconds <= phases[0].seconds);
+
+    double totalMs = 0.0;
+    IsProfileOverBudget(1e9, totalMs);
+    CHECK(totalMs == (phases[0].seconds + phases[2].seconds) * 1000.0);
+    CHECK(totalMs >= 45.0);
+}
+
+/**
+ * The check fires only when the top-level total exceeds the budget
+ */
+static void TestBudget() {
+    ClearProfilePhases();
+    BeginProfilePhase("Startup");
+    SleepMs(30);
+    EndProfilePhase();
+
+    double totalMs = 0.0;
+    CHECK(IsProfileOverBudget(10.0, totalMs));
+    CHECK(totalMs >= 30.0);
+    CHECK(!IsProfileOverBudget(totalMs, totalMs));
+    CHECK(!IsProfileOverBudget(60000.0, totalMs));
+
+    ClearProfilePhases();
+    CHECK(!IsProfileOverBudget(0.0, totalMs));
+    CHECK(totalMs == 0.0);
+}
+
+/**
+ * Phases past the table size are dropped but Begin/End stay paired
+ */
+static void TestTableOverflow() {
+    ClearProfilePhases();
+    BeginProfilePhase("Root");
+    for (int i = 0; i < PROFILE_MAX_PHASES + 8; i++) {
+        BeginProfilePhase("Extra");
+        EndProfilePhase();
+    }
+    EndProfilePhase();
+
+    const ProfilePhase* phases = nullptr;
+    CHECK(GetProfilePhases(phases) == PROFILE_MAX_PHASES);
+    CHECK(phases[0].seconds > 0.0);
+    double totalMs = 0.0;
+    IsProfileOverBudget(1e9, totalMs);
+    CHECK(totalMs == phases[0].seconds * 1000.0);
+}
+
+int main() {
+    TestNestedPhasesCountedOnce();
+    TestBudget();
+    TestTableOverflow();
+    ClearProfilePhases();
+    if (s_failures > 0) {
+        std::printf("ProfilingTest: %d checks failed\n", s_failures);
+        return 1;
+    }
+    std::printf("ProfilingTest: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * XPLMStub - dataref storage standing in for X-Plane in the test programs
+ * See XPLMStub.h for an overview.
+ */
+
+#include "XPLMStub.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+struct StubDataRef {
+    int value = 0;
+    std::vector<float> floats;
+    std::vector<int> ints;
+    std::vector<char> bytes;
+};
+
+static std::map<std::string, StubDataRef> s_dataRefs;     // Node-based: entries never move
+
+static StubDataRef& Entry(XPLMDataRef ref) {
+    return *static_cast<StubDataRef*>(ref);
+}
+
+/**
+ * Copy out of an array entry the way XPLMGetDatav* does
+ * @return Elements copied, or the array size when out is null
+ */
+template <typename T>
+static int CopyOut(const std::vector<T>& values, T* out, int offset, int max) {
+    int size = static_cast<int>(values.size());
+    if (!out) return size;
+    int count = std::clamp(std::min(max, size - offset), 0, size);
+    if (count > 0) std::memcpy(out, values.data() + offset, count * sizeof(T));
+    return count;
+}
+
+XPLMDataRef XPLMFindDataRef(const char* inDataRefName) {
+    return &s_dataRefs[inDataRefName];
+}
+
+int XPLMGetDatai(XPLMDataRef inDataRef) {
+    return inDataRef ? Entry(inDataRef).value : 0;
+}
+
+int XPLMGetDatavf(XPLMDataRef inDataRef, float* outValues, int inOffset, int inMax) {
+    return inDataRef ? CopyOut(Entry(inDataRef).floats, outValues, inOffset, inMax) : 0;
+}
+
+int XPLMGetDatavi(XPLMDataRef inDataRef, int* outValues, int inOffset, int inMax) {
+    return inDataRef ? CopyOut(Entry(inDataRef).ints, outValues, inOffset, inMax) : 0;
+}
+
+int XPLMGetDatab(XPLMDataRef inDataRef, void* outValue, int inOffset, int inMaxBytes) {
+    return inDataRef ? CopyOut(Entry(inDataRef).bytes, static_cast<char*>(outValue), inOffset, inMaxBytes) : 0;
+}
+
+void StubSetDatai(XPLMDataRef ref, int value) {
+    Entry(ref).value = value;
+}
+
+void StubSetDatavf(XPLMDataRef ref, const float* values, int count) {
+    Entry(ref).floats.assign(values, values + count);
+}
+
+void StubSetDatavi(XPLMDataRef ref, const int* values, int count) {
+    Entry(ref).ints.assign(values, values + count);
+}
+
+void StubSetDatab(XPLMDataRef ref, const void* values, int bytes) {
+    const char* begin = static_cast<const char*>(values);
+    Entry(ref).bytes.assign(begin, begin + bytes);
+}
@@ -0,0 +1,19 @@
+/**
+ * XPLMStub - dataref storage standing in for X-Plane in the test programs
+ *
+ * XPLMFindDataRef hands out one entry per name, created on first lookup, and
+ * the XPLMGetData* calls read back what the test wrote with the StubSet*
+ * functions. An entry nothing was written to reads as zero or empty, like a
+ * dataref the sim does not publish. Writes reuse the entry's storage once it
+ * is big enough, so a test can feed the plugin code every frame without
+ * allocating.
+ */
+
+#pragma once
+
+#include "XPLMDataAccess.h"
+
+void StubSetDatai(XPLMDataRef ref, int value);
+void StubSetDatavf(XPLMDataRef ref, const float* values, int count);
+void StubSetDatavi(XPLMDataRef ref, const int* values, int count);
+void StubSetDatab(XPLMDataRef ref, const void* values, int bytes);